@@ -0,0 +1,874 @@
+// Font sans24 sampled down by 2, 4 bpp anti aliased. Generated by tools/fontgen, do not edit.
+
+#include <stdlib.h>
+
+#include "tft_fonts.h"
+
+const unsigned char font_sans12aa_bits[9048] = 
+{
+    0x48, 0x88, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF,
+    0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x48, 0x88, 0xFF,
+    0x8F, 0xF4, 0x88, 0x88, 0x00, 0x48, 0x4F, 0xF0, 0x08, 0xF8, 0xFF, 0x00,
+    0x8F, 0x8F, 0xF0, 0x08, 0xF8, 0xFF, 0x00, 0x8F, 0x8F, 0xF0, 0x08, 0xF8,
+    0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x0F, 0xB0, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x00, 0x4F, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x0F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+    0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x88, 0x88, 0xFF, 0x88, 0x8B, 0xF8, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x8B, 0xFB, 0x88, 0xBF, 0xB8, 0x88, 0x40,
+    0x00, 0x08, 0xF0, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x04,
+    0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x88, 0x80, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x4F, 0xFB, 0x8F, 0x88, 0xBF, 0x0F, 0xF4, 0x00, 0xF0, 0x00,
+    0x00, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xF0, 0x00, 0x00,
+    0x8F, 0xFB, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB8, 0x00, 0x00,
+    0x08, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xF0, 0x4B, 0xFB, 0x00, 0x00,
+    0x0F, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x0F,
+    0x00, 0xBF, 0xBF, 0xFB, 0x88, 0xF8, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xF4, 0x00, 0x04, 0x88, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xFB,
+    0x8B, 0xF8, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00,
+    0x8F, 0x40, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x08, 0xF4, 0x00, 0x00, 0x00,
+    0x4F, 0xB0, 0x00, 0xBF, 0x40, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4,
+    0x04, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4,
+    0x04, 0xF8, 0x00, 0x48, 0x84, 0x00, 0x00, 0x08, 0x88, 0x00, 0x0F, 0xB0,
+    0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x8F, 0xB0,
+    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xBF, 0x40, 0x04, 0xFB,
+    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x4F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+    0x8F, 0x80, 0x08, 0xF8, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x4F, 0xF8,
+    0x8F, 0xF0, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x04, 0xBF, 0xFB, 0x40,
+    0x00, 0x00, 0x4B, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFB,
+    0x00, 0x00, 0x04, 0x84, 0x00, 0xBF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0xBF,
+    0x80, 0x4F, 0xF0, 0x00, 0x4F, 0xFB, 0x00, 0x0F, 0xF0, 0x08, 0xF8, 0x00,
+    0x00, 0x4F, 0xFB, 0x04, 0xFB, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x4F, 0xFB,
+    0x8F, 0x40, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x0F,
+    0xF4, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x40, 0x04,
+    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xF4,
+    0x00, 0x00, 0x4B, 0xFF, 0xFB, 0x80, 0x00, 0x48, 0x84, 0x88, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0x84, 0x00, 0x4F, 0xB0, 0x00, 0xBF,
+    0x40, 0x04, 0xFB, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x8F, 0x80,
+    0x00, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x8F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x04, 0xFB,
+    0x00, 0x00, 0xBF, 0x40, 0x00, 0x4F, 0xB0, 0x00, 0x08, 0x84, 0x88, 0x40,
+    0x00, 0x4F, 0xB0, 0x00, 0x0B, 0xF4, 0x00, 0x04, 0xFB, 0x00, 0x00, 0xBF,
+    0x40, 0x00, 0x8F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x08,
+    0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08,
+    0xF8, 0x00, 0x08, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x8F,
+    0x80, 0x00, 0xBF, 0x40, 0x04, 0xFB, 0x00, 0x0B, 0xF4, 0x00, 0x4F, 0xB0,
+    0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x4B, 0x40, 0x0F, 0x80, 0x08, 0xB4, 0xBF, 0x80, 0xF8,
+    0x4B, 0xF8, 0x00, 0x4B, 0xBF, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+    0x00, 0x00, 0x4B, 0xBF, 0xBF, 0x80, 0x04, 0xBF, 0x80, 0xF8, 0x4B, 0xF8,
+    0x4B, 0x40, 0x0F, 0x80, 0x08, 0xB0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x80, 0xFF, 0x0F, 0xF4, 0xF8, 0x8F, 0x0F, 0xB0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0x40,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0x84, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0xBF, 0xF0, 0x00,
+    0x8F, 0xB0, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0xFF,
+    0x04, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x8F, 0x88, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00,
+    0x00, 0x8F, 0x88, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x4F, 0xF0,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xF0, 0x08,
+    0xFB, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFB, 0x00, 0x0B, 0xFF, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4B, 0xFF, 0xF8, 0x40,
+    0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
+    0x8F, 0xFB, 0xBF, 0x80, 0x00, 0x04, 0x40, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x04,
+    0x88, 0x8B, 0xFB, 0x88, 0x84, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x88,
+    0x88, 0x88, 0x88, 0x84, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB0, 0xFB, 0x84, 0x00, 0x08, 0xFF, 0x44, 0x00, 0x00, 0x00,
+    0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
+    0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00,
+    0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B,
+    0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x48, 0xFF, 0xFF, 0xFB, 0x40,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x48, 0x00, 0x00, 0x08, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x08, 0x88, 0x8F, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x08, 0x88, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF4, 0xB8, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x00, 0x48, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFB,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0x0B,
+    0xF4, 0x00, 0xFF, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x04,
+    0xFB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00,
+    0x8F, 0xB0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x88, 0x88, 0x8F, 0xF8,
+    0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x8F,
+    0xF8, 0x84, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x80, 0x00, 0x48, 0x88, 0x88, 0x88, 0x84, 0x08, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x8F, 0xB8, 0x88, 0x88, 0x84, 0x08, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xBF, 0xFF, 0xB8, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+    0x88, 0x40, 0x00, 0x8B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x8B, 0x80, 0x00, 0x04, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF4, 0x08, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF,
+    0xB4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF8, 0x00,
+    0x00, 0x44, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+    0x8F, 0xFF, 0xB8, 0x00, 0x08, 0xF8, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x8F,
+    0xFF, 0xB4, 0x00, 0x8F, 0xFB, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xF0,
+    0x8F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00,
+    0x0B, 0xF8, 0x08, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xFB, 0x40,
+    0x08, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x48,
+    0xFF, 0xFB, 0x80, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0xBF, 0x80, 0x00, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xB8,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x08, 0xFF, 0x80, 0x00,
+    0x8F, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xF0, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x08, 0xFB,
+    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0x88, 0x8F, 0xFB, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFB, 0x88, 0x8B, 0xFF, 0x40,
+    0x0F, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x0B,
+    0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00, 0x00, 0x00,
+    0x08, 0xF8, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xB4, 0x00,
+    0x04, 0xBF, 0xB0, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8B,
+    0xFF, 0xFB, 0x80, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0x84, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x04, 0xBF, 0xF0, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x8F, 0xB0, 0x00, 0x00, 0x04, 0xFF,
+    0x08, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x88, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x0F, 0xF4, 0x00, 0x00,
+    0x0B, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x4B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFB, 0x8F, 0x80, 0x00, 0x8B, 0xFF, 0xF8, 0x0B, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x44, 0x00, 0x00, 0x8F, 0xFB, 0x00,
+    0x08, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x84, 0x00,
+    0x00, 0x88, 0x4F, 0xF8, 0xFF, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x84, 0xFF, 0x8F, 0xF8, 0x88, 0x40, 0x08, 0x80, 0xFF,
+    0x0F, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x0F, 0xF0, 0xFF, 0x4F, 0x88, 0xF0, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0x00,
+    0x00, 0x00, 0x04, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x04, 0x8F, 0xFF, 0xFB,
+    0x80, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0x84, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x8F, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF,
+    0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF,
+    0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x00, 0x00,
+    0x08, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00,
+    0x00, 0x4F, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x8F, 0xFF, 0xB4, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x8F, 0x80,
+    0x00, 0x8F, 0xF4, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x04, 0xFF,
+    0x40, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x88, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+    0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8F, 0xFF,
+    0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x80, 0x00, 0x04, 0x8F, 0xFF,
+    0x40, 0x00, 0x00, 0xBF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
+    0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x4F,
+    0xF0, 0x00, 0x04, 0x88, 0x40, 0x48, 0x40, 0x0B, 0xF4, 0x0B, 0xF8, 0x00,
+    0x08, 0xFF, 0xFF, 0xB8, 0xF8, 0x00, 0x8F, 0xB0, 0xFF, 0x00, 0x04, 0xFF,
+    0xB8, 0x8F, 0xFF, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xBF, 0x80, 0x00,
+    0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x4F, 0xB8, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xF8,
+    0x4F, 0xB0, 0x00, 0x8F, 0xB4, 0x00, 0x8F, 0xF8, 0x4B, 0xFB, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x00, 0x0B, 0xFB, 0x00,
+    0x04, 0xBF, 0xFB, 0x48, 0xFF, 0x84, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x04,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x88, 0x8F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x4F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x08,
+    0xFB, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00,
+    0x4F, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x4F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x88,
+    0x88, 0x88, 0x88, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF,
+    0x88, 0x88, 0x8B, 0xFF, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF,
+    0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x88, 0x88, 0x8B, 0xFF, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xB0, 0xFF,
+    0x00, 0x00, 0x00, 0x0B, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x4F, 0xFB, 0x40, 0x00, 0x08, 0xBF, 0x80, 0x0F, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x04, 0x80, 0x04, 0xFF, 0xB8, 0x00, 0x00, 0x8B, 0xF8, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8B, 0xFF, 0xFF,
+    0xB8, 0x00, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xFB, 0x40,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF,
+    0x00, 0x00, 0x00, 0x04, 0xBF, 0xF0, 0x0F, 0xF8, 0x88, 0x88, 0x8F, 0xFF,
+    0xB4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0x88, 0x88,
+    0x88, 0x80, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x88, 0x88, 0x88,
+    0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF8, 0x88, 0x88, 0x88, 0x84,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x84,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x88, 0x88, 0x88, 0x84, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xFB, 0x80, 0x00, 0x08,
+    0x8F, 0xF0, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x0B, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x04, 0x88,
+    0x88, 0x84, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x8F, 0x80,
+    0x00, 0x00, 0x04, 0x88, 0x8B, 0xF8, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x0B, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x08, 0xF8, 0x00, 0x4F, 0xFB, 0x80, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xFB,
+    0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x04, 0xFB, 0x00, 0x4B, 0xF8, 0x8F, 0xFF, 0xF0, 0x8F, 0xF8, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFB,
+    0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x4F,
+    0xFB, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0x00,
+    0x8F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x08, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x4F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x84, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x88, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x84, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0x0F, 0xF8, 0xF8, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x8F, 0xB8, 0xF8,
+    0xFF, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x48, 0xF8, 0xFF, 0x08, 0xFB, 0x00,
+    0x04, 0xFF, 0x08, 0xF8, 0xFF, 0x00, 0xFF, 0x00, 0x08, 0xF8, 0x08, 0xF8,
+    0xFF, 0x00, 0x8F, 0x80, 0x0F, 0xF0, 0x08, 0xF8, 0xFF, 0x00, 0x4F, 0xF0,
+    0x8F, 0xB0, 0x08, 0xF8, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x08, 0xF8,
+    0xFF, 0x00, 0x08, 0xFB, 0xFF, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x08, 0xF8,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x88, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F,
+    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x8F, 0xB0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x08, 0xFB, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x4F, 0xF0, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x04, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x4F, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xBF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x80,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xB8, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F,
+    0xFB, 0x40, 0x00, 0x4B, 0xFF, 0x40, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x4F, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x48, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x84, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x80, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+    0x00, 0x04, 0xFF, 0xB4, 0x00, 0x04, 0xBF, 0xF4, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFB, 0x80,
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x84, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x40, 0xFF, 0x88, 0x88, 0x8F, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
+    0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFB, 0xFF, 0x00,
+    0x00, 0x08, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xB8, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F,
+    0xFB, 0x40, 0x00, 0x4B, 0xFF, 0x40, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x4F, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x48, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x84, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xB0, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+    0x00, 0x04, 0xFF, 0xB4, 0x00, 0x04, 0xBF, 0xF4, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x80, 0x00, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x8F, 0xFF, 0x40,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+    0xFF, 0x88, 0x88, 0x8F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4,
+    0x00, 0x00, 0xFF, 0x88, 0x88, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFB,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x08,
+    0xBF, 0xFF, 0xF8, 0x80, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B,
+    0xFB, 0x40, 0x00, 0x48, 0xF8, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB8, 0x80,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x48, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x48,
+    0xF8, 0x80, 0x00, 0x08, 0xBF, 0xB0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x48, 0xBF, 0xFF, 0xFB, 0x80, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+    0xFF, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x48, 0x40, 0x00, 0x00, 0x00, 0x04, 0x84, 0x8F, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08,
+    0xF8, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x4F, 0xF0, 0x00, 0x00,
+    0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x08, 0xFF,
+    0x80, 0x00, 0x08, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x84, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x4F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x0F, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x80, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x4F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF8, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x08,
+    0x88, 0x40, 0x00, 0x00, 0x04, 0x84, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
+    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x8F, 0x80, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+    0x00, 0x00, 0x0F, 0xF0, 0x4F, 0xF0, 0x00, 0x00, 0x8F, 0x8F, 0xF0, 0x00,
+    0x00, 0x8F, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x00,
+    0x8F, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x08, 0xF8, 0x00, 0x00, 0xFF,
+    0x40, 0x08, 0xF8, 0x00, 0x04, 0xFF, 0x08, 0xFB, 0x00, 0x00, 0xFF, 0x00,
+    0x04, 0xFF, 0x00, 0x08, 0xF8, 0x00, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00,
+    0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x08, 0xF8, 0x00, 0x00, 0xBF,
+    0x80, 0x0F, 0xF0, 0x00, 0x8F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x8F, 0x80,
+    0x4F, 0xF0, 0x00, 0x8F, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xF0, 0x8F,
+    0x80, 0x00, 0x0F, 0xF0, 0x8F, 0xB0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x80,
+    0x00, 0x0F, 0xF4, 0x8F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0xFF, 0x00, 0x00,
+    0x08, 0xF8, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x08,
+    0xF8, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00,
+    0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0B, 0xF8, 0x00,
+    0x00, 0x00, 0xBF, 0xB0, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+    0x00, 0x8F, 0xB0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B,
+    0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x44, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x0B, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x0B,
+    0xFB, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x8F,
+    0xF0, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
+    0xB0, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x04, 0x88, 0x4F,
+    0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0xBF,
+    0xB0, 0x00, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+    0x4F, 0xF4, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00,
+    0xFF, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x48, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x84, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x48, 0x88, 0x88, 0x88, 0x88, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0x88, 0x8F,
+    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x88, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x04,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0x4F, 0xB0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x08, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0x88, 0x88, 0x4F, 0xFF, 0xF8,
+    0x88, 0xBF, 0x80, 0x08, 0xF8, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00, 0x8F,
+    0x80, 0x08, 0xF8, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00, 0x8F, 0x80, 0x08,
+    0xF8, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00,
+    0x8F, 0x80, 0x08, 0xF8, 0x00, 0x8F, 0x88, 0x8B, 0xF8, 0xFF, 0xFF, 0x88,
+    0x88, 0x84, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x4F, 0xFB, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+    0x00, 0xBF, 0xB0, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x4F,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x40, 0x00, 0x4F, 0xF0,
+    0x00, 0x04, 0xFB, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x88,
+    0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0x84,
+    0x00, 0x04, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x88, 0x88, 0x8B, 0xF8, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xB8, 0x88, 0x8B, 0xF8, 0x4F, 0xF0,
+    0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x8F, 0x80,
+    0x00, 0x00, 0x4F, 0xF8, 0x4F, 0xF8, 0x00, 0x08, 0xFF, 0xF8, 0x0B, 0xFF,
+    0xFF, 0xFF, 0xB8, 0xF8, 0x00, 0x8F, 0xFF, 0xB8, 0x04, 0x84, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x4F,
+    0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFB, 0x40, 0x08, 0xFF, 0x40, 0xFF, 0xB0,
+    0x00, 0x00, 0x4F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x80,
+    0x00, 0x00, 0x0F, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xF0, 0xFF, 0xFB,
+    0x40, 0x08, 0xFF, 0x40, 0xFF, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0x88, 0x04,
+    0xBF, 0xFB, 0x80, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0xB8, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x04, 0xFF, 0xB0, 0x00, 0x48, 0x80, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x40, 0x04, 0x88, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x48, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x08, 0xBF, 0xFB, 0x40, 0xFF, 0x00, 0xBF, 0xFF,
+    0xFF, 0xF4, 0xFF, 0x08, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0x0F, 0xF4, 0x00,
+    0x00, 0x0B, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00,
+    0x00, 0x08, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x08, 0xFF, 0x80,
+    0x04, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x08, 0xFF,
+    0xFB, 0x40, 0x88, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x4B, 0xFB, 0x00, 0xBF,
+    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x88,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x88, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFB, 0x40, 0x00, 0x48, 0xB0, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x40, 0x00, 0x00,
+    0x48, 0x88, 0x40, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x4F, 0xF8, 0x88, 0x40,
+    0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x04, 0x8B, 0xFB, 0x88,
+    0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0x04, 0x8B, 0xFB, 0x88, 0x80, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFB, 0x40, 0x88, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0xFF,
+    0x08, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
+    0x4F, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x8F, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0xFF,
+    0x0B, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0x04, 0xFF, 0xF8, 0x8B, 0xFB, 0xFF,
+    0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0xFF, 0x00, 0x00, 0x88, 0x84, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x4F, 0xF4,
+    0x00, 0xFF, 0x88, 0x8B, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x4B,
+    0xFF, 0xF8, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFB, 0x0F, 0xFF, 0xB4, 0x00,
+    0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xBF, 0xF4, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00,
+    0x00, 0x08, 0x80, 0x88, 0xFF, 0xFF, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x08,
+    0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+    0x00, 0x4F, 0xF4, 0x8F, 0xF8, 0x8F, 0xFB, 0x04, 0x88, 0x00, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x48, 0x84, 0xFF, 0x00, 0x00, 0x4F, 0xFB,
+    0x0F, 0xF0, 0x00, 0x4F, 0xFB, 0x00, 0xFF, 0x00, 0x4F, 0xFB, 0x00, 0x0F,
+    0xF0, 0x8F, 0xF8, 0x00, 0x00, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0xBF,
+    0xF4, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
+    0xF4, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x4F,
+    0xF4, 0x88, 0x00, 0x00, 0x00, 0x48, 0x80, 0x88, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x88, 0x88, 0x04, 0xBF, 0xFB, 0x40, 0x00, 0x8F, 0xFF, 0xB0, 0x0F,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFB, 0x40,
+    0x0B, 0xFF, 0x8F, 0x80, 0x04, 0xFF, 0x8F, 0xFB, 0x00, 0x00, 0x0F, 0xFF,
+    0x40, 0x00, 0x08, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x08, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x80, 0x00, 0x00, 0x04, 0x84, 0x00,
+    0x00, 0x00, 0x88, 0x88, 0x04, 0xBF, 0xFF, 0x80, 0x0F, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xB0, 0xFF, 0xFB, 0x40, 0x04, 0xFF, 0x8F, 0xFB, 0x00, 0x00, 0x08,
+    0xFB, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x0F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x88, 0x00, 0x04, 0xBF, 0xFF,
+    0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0x80,
+    0x00, 0x8F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xF0, 0x4F, 0xF0,
+    0x00, 0x00, 0x00, 0xFF, 0x48, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8F,
+    0x80, 0x00, 0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+    0xF4, 0x0F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x4F, 0xF8, 0x00, 0x08,
+    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4B, 0xFF,
+    0xFB, 0x40, 0x00, 0x88, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x4F, 0xFF,
+    0xFF, 0xFB, 0x00, 0xFF, 0xFB, 0x40, 0x08, 0xFF, 0x40, 0xFF, 0xB0, 0x00,
+    0x00, 0x4F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00,
+    0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00,
+    0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x80, 0x00,
+    0x00, 0x0F, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xF0, 0xFF, 0xFB, 0x40,
+    0x08, 0xFF, 0x40, 0xFF, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0x04, 0xBF,
+    0xFB, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF,
+    0xFB, 0x40, 0x88, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0xFF, 0x08, 0xFF, 0x80,
+    0x04, 0xBF, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x4F, 0xF0, 0x00,
+    0x00, 0x08, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0x0F, 0xF4, 0x00,
+    0x00, 0x0B, 0xFF, 0x08, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0x00, 0xBF, 0xFF,
+    0xFF, 0xF4, 0xFF, 0x00, 0x08, 0xFF, 0xFB, 0x40, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x88, 0x04, 0xBF, 0xF8, 0xFF, 0x4F, 0xFF, 0xF8, 0xFF,
+    0xFB, 0x40, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0xFF, 0xFB, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x4F, 0xF8, 0x00,
+    0x04, 0x88, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x48,
+    0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x80, 0x00, 0x4B, 0xFB, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x08, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0x8F,
+    0xF8, 0x88, 0x84, 0x8F, 0xFF, 0xFF, 0xFF, 0x84, 0x8F, 0xF8, 0x88, 0x84,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+    0x00, 0xBF, 0xB8, 0x88, 0x40, 0x04, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x88,
+    0x88, 0x40, 0x88, 0x00, 0x00, 0x00, 0x08, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xBF, 0x80, 0x00,
+    0x00, 0xBF, 0xF8, 0xFF, 0x40, 0x04, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xF0, 0x08, 0xFF, 0xFB, 0x40, 0x88, 0x48, 0x40, 0x00, 0x00, 0x00,
+    0x08, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x0B, 0xF8, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0xFF, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x4F,
+    0xF0, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x00,
+    0x08, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x8F, 0xB0, 0x00,
+    0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFB, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00, 0x04, 0x84, 0xBF,
+    0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x8F, 0x80, 0x00, 0x4F,
+    0xFF, 0xB0, 0x00, 0x0F, 0xF0, 0x4F, 0xF0, 0x00, 0x8F, 0x8F, 0xF0, 0x00,
+    0x8F, 0xB0, 0x0F, 0xF0, 0x00, 0xBF, 0x8B, 0xF4, 0x00, 0x8F, 0x80, 0x08,
+    0xF8, 0x00, 0xFF, 0x08, 0xF8, 0x00, 0xFF, 0x40, 0x08, 0xF8, 0x04, 0xFB,
+    0x04, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x08, 0xF8, 0x00, 0xFF, 0x08,
+    0xF8, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0xBF, 0x48, 0xF8, 0x00, 0x00,
+    0x8F, 0x8F, 0xF0, 0x00, 0x8F, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0xFF, 0xB0,
+    0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
+    0x04, 0x88, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+    0x00, 0x48, 0x80, 0x4F, 0xF4, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x8F, 0xF0,
+    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xB0, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+    0xFF, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x4F, 0xF4,
+    0x00, 0x00, 0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+    0xBF, 0xB0, 0x0B, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0x44, 0x88, 0x00, 0x00,
+    0x00, 0x04, 0x88, 0x48, 0x80, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x4F,
+    0xF0, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00,
+    0x08, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0xFB, 0x08, 0xFB,
+    0x00, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xBF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x04,
+    0x8B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88,
+    0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88, 0x8B, 0xFF, 0x40,
+    0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+    0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+    0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00,
+    0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x88, 0x88, 0x88,
+    0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
+    0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x04, 0xFF,
+    0xB8, 0x80, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80,
+    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00,
+    0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8,
+    0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x04, 0x8F, 0xFF, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x88, 0x84, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00,
+    0x88, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8,
+    0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x0F, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x8F, 0xFF, 0xFF, 0xF8, 0x40, 0x04, 0xBF, 0x8F, 0xF8, 0x88,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x80, 0x00, 0x00, 0x48, 0xFF, 0xFB, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x88, 0x88, 0x88, 0x88, 0xBF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x88, 0x88, 0x88, 0x88, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+};
+
+const tft_gfx_glyph_t font_sans12aa_glyphs[97] = 
+{
+    {     0,   0,   0,   8,   0,   0 },   // 0x20
+    {     0,   3,  18,  10,   3, -17 },   // 0x21
+    {    27,   7,   7,  11,   2, -17 },   // 0x22
+    {    52,  16,  18,  20,   2, -17 },   // 0x23
+    {   196,  11,  21,  15,   2, -17 },   // 0x24
+    {   312,  20,  18,  23,   1, -17 },   // 0x25
+    {   492,  17,  18,  19,   1, -17 },   // 0x26
+    {   645,   2,   7,   7,   2, -17 },   // 0x27
+    {   652,   6,  22,   9,   2, -18 },   // 0x28
+    {   718,   6,  22,   9,   2, -18 },   // 0x29
+    {   784,  11,  11,  12,   0, -17 },   // 0x2A
+    {   845,  16,  16,  20,   2, -15 },   // 0x2B
+    {   973,   3,   6,   8,   2,  -3 },   // 0x2C
+    {   982,   6,   2,   9,   1,  -7 },   // 0x2D
+    {   988,   2,   4,   8,   3,  -3 },   // 0x2E
+    {   992,   8,  20,   8,   0, -17 },   // 0x2F
+    {  1072,  13,  18,  15,   1, -17 },   // 0x30
+    {  1189,  11,  18,  15,   2, -17 },   // 0x31
+    {  1288,  11,  18,  15,   2, -17 },   // 0x32
+    {  1387,  12,  18,  15,   2, -17 },   // 0x33
+    {  1495,  13,  18,  15,   1, -17 },   // 0x34
+    {  1612,  11,  18,  15,   2, -17 },   // 0x35
+    {  1711,  13,  18,  15,   1, -17 },   // 0x36
+    {  1828,  11,  18,  15,   2, -17 },   // 0x37
+    {  1927,  13,  18,  15,   1, -17 },   // 0x38
+    {  2044,  13,  18,  15,   1, -17 },   // 0x39
+    {  2161,   3,  13,   8,   3, -12 },   // 0x3A
+    {  2181,   3,  15,   8,   2, -12 },   // 0x3B
+    {  2204,  15,  13,  20,   2, -13 },   // 0x3C
+    {  2302,  15,   8,  20,   2, -11 },   // 0x3D
+    {  2362,  15,  13,  20,   2, -13 },   // 0x3E
+    {  2460,  10,  18,  13,   1, -17 },   // 0x3F
+    {  2550,  21,  21,  24,   1, -16 },   // 0x40
+    {  2771,  16,  18,  16,   0, -17 },   // 0x41
+    {  2915,  12,  18,  16,   2, -17 },   // 0x42
+    {  3023,  15,  18,  17,   1, -17 },   // 0x43
+    {  3158,  15,  18,  18,   2, -17 },   // 0x44
+    {  3293,  11,  18,  15,   2, -17 },   // 0x45
+    {  3392,  10,  18,  14,   2, -17 },   // 0x46
+    {  3482,  16,  18,  18,   1, -17 },   // 0x47
+    {  3626,  13,  18,  18,   2, -17 },   // 0x48
+    {  3743,   2,  18,   7,   2, -17 },   // 0x49
+    {  3761,   6,  22,   7,  -2, -17 },   // 0x4A
+    {  3827,  14,  18,  16,   2, -17 },   // 0x4B
+    {  3953,  11,  18,  13,   2, -17 },   // 0x4C
+    {  4052,  16,  18,  21,   2, -17 },   // 0x4D
+    {  4196,  13,  18,  18,   2, -17 },   // 0x4E
+    {  4313,  17,  18,  19,   1, -17 },   // 0x4F
+    {  4466,  11,  18,  14,   2, -17 },   // 0x50
+    {  4565,  17,  21,  19,   1, -17 },   // 0x51
+    {  4744,  14,  18,  17,   2, -17 },   // 0x52
+    {  4870,  13,  18,  15,   1, -17 },   // 0x53
+    {  4987,  14,  18,  15,   0, -17 },   // 0x54
+    {  5113,  14,  18,  17,   2, -17 },   // 0x55
+    {  5239,  16,  18,  16,   0, -17 },   // 0x56
+    {  5383,  22,  18,  23,   1, -17 },   // 0x57
+    {  5581,  15,  18,  16,   0, -17 },   // 0x58
+    {  5716,  14,  18,  15,   0, -17 },   // 0x59
+    {  5842,  14,  18,  16,   1, -17 },   // 0x5A
+    {  5968,   5,  22,   9,   2, -18 },   // 0x5B
+    {  6023,   8,  20,   8,   0, -17 },   // 0x5C
+    {  6103,   5,  22,   9,   2, -18 },   // 0x5D
+    {  6158,  15,   7,  20,   2, -17 },   // 0x5E
+    {  6211,  12,   2,  12,   0,   4 },   // 0x5F
+    {  6223,   6,   5,  12,   2, -19 },   // 0x60
+    {  6238,  12,  14,  15,   1, -13 },   // 0x61
+    {  6322,  12,  19,  15,   2, -18 },   // 0x62
+    {  6436,  11,  14,  13,   1, -13 },   // 0x63
+    {  6513,  12,  19,  15,   1, -18 },   // 0x64
+    {  6627,  13,  14,  15,   1, -13 },   // 0x65
+    {  6718,   9,  19,   9,   0, -18 },   // 0x66
+    {  6804,  12,  19,  15,   1, -13 },   // 0x67
+    {  6918,  11,  19,  15,   2, -18 },   // 0x68
+    {  7023,   2,  19,   7,   2, -18 },   // 0x69
+    {  7042,   5,  24,   7,  -1, -18 },   // 0x6A
+    {  7102,  11,  19,  14,   2, -18 },   // 0x6B
+    {  7207,   2,  19,   7,   2, -18 },   // 0x6C
+    {  7226,  19,  14,  23,   2, -13 },   // 0x6D
+    {  7359,  11,  14,  15,   2, -13 },   // 0x6E
+    {  7436,  13,  14,  15,   1, -13 },   // 0x6F
+    {  7527,  12,  19,  15,   2, -13 },   // 0x70
+    {  7641,  12,  19,  15,   1, -13 },   // 0x71
+    {  7755,   8,  14,  10,   2, -13 },   // 0x72
+    {  7811,  10,  14,  12,   1, -13 },   // 0x73
+    {  7881,   9,  17,   9,   0, -16 },   // 0x74
+    {  7958,  11,  14,  15,   2, -13 },   // 0x75
+    {  8035,  13,  14,  14,   0, -13 },   // 0x76
+    {  8126,  18,  14,  19,   1, -13 },   // 0x77
+    {  8252,  13,  14,  14,   0, -13 },   // 0x78
+    {  8343,  13,  19,  14,   0, -13 },   // 0x79
+    {  8467,  11,  14,  13,   1, -13 },   // 0x7A
+    {  8544,   9,  22,  15,   3, -18 },   // 0x7B
+    {  8643,   2,  24,   8,   3, -18 },   // 0x7C
+    {  8667,   9,  22,  15,   3, -18 },   // 0x7D
+    {  8766,  15,   4,  20,   2,  -9 },   // 0x7E
+    {  8796,  12,  21,  14,   1, -16 },   // 0x7F
+    {  8922,  12,  21,  14,   1, -16 },   // 0x80
+};
+
+const tft_font_t tft_font_sans12aa = 
+{
+    .id = TFT_FONT_SANS12AA, .first = 32, .count = 97, .height = 25,
+    .gap = 0, .scale = 1, .format = TFT_FONT_FMT_AA,
+    .bitmap = font_sans12aa_bits, .glyphs = font_sans12aa_glyphs,
+    .baseline = 19, .bpp = 4
+};
+
+// EOF
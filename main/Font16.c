@@ -524,3 +524,9 @@ const unsigned char* chrtbl_f16[96] =       // character pointer table
         chr_f16_78, chr_f16_79, chr_f16_7A, chr_f16_7B, chr_f16_7C, chr_f16_7D, chr_f16_7E, chr_f16_7F
 };
 
+const tft_font_t tft_font_f16 = 
+{
+    .id = TFT_FONT_16, .chrtbl = chrtbl_f16, .widtbl = widtbl_f16,
+    .first = firstchr_f16, .count = nr_chrs_f16, .height = chr_hgt_f16,
+    .gap = 1, .scale = 1, .format = TFT_FONT_FMT_FIXED
+};
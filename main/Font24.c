@@ -1,16 +1,10 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <time.h>
+// DejaVu Sans 24pt, Adafruit GFX layout (proportional, packed bitmap)
 
-#include <string.h>
-#include <time.h>
-#include <stdio.h>
-#include <sys/time.h>
+#include <stdlib.h>
 
-#define PROGMEM
+#include "tft_fonts.h"
 
-const uint8_t DejaVuSans24pt8bBitmaps[] PROGMEM = {
+const unsigned char DejaVuSans24pt8bBitmaps[] = {
   0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
   0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0,
   0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
@@ -716,7 +710,7 @@ const uint8_t DejaVuSans24pt8bBitmaps[] PROGMEM = {
   0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
 
-const GFXglyph DejaVuSans24pt8bGlyphs[] PROGMEM = {
+const tft_gfx_glyph_t DejaVuSans24pt8bGlyphs[] = {
   {     0,   1,   1,  15,    0,    0 },   // 0x20 ' '
   {     1,   5,  34,  19,    7,  -33 },   // 0x21 '!'
   {    23,  13,  13,  22,    4,  -33 },   // 0x22 '"'
@@ -815,9 +809,14 @@ const GFXglyph DejaVuSans24pt8bGlyphs[] PROGMEM = {
   {  8197,  24,  41,  28,    2,  -32 },   // 0x7F
   {  8320,  24,  41,  28,    2,  -32 } }; // 0x80
 
-const GFXfont DejaVuSans24pt8b PROGMEM = {
-  (uint8_t  *)DejaVuSans24pt8bBitmaps,
-  (GFXglyph *)DejaVuSans24pt8bGlyphs,
-  0x20, 0x80, 55 };
+// Cell is ascent (37) + descent (12), baseline at 37
+
+const tft_font_t tft_font_sans24 = 
+{
+    .id = TFT_FONT_SANS24, .first = 0x20, .count = 0x80 - 0x20 + 1,
+    .height = 49, .gap = 0, .scale = 1, .format = TFT_FONT_FMT_GFX,
+    .bitmap = DejaVuSans24pt8bBitmaps, .glyphs = DejaVuSans24pt8bGlyphs,
+    .baseline = 37
+};
 
 // Approx. 9129 bytes
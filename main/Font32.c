@@ -1037,3 +1037,9 @@ const unsigned char* chrtbl_f32[96] =       // character pointer table
         chr_f32_78, chr_f32_79, chr_f32_7A, chr_f32_7B, chr_f32_7C, chr_f32_7D, chr_f32_7E, chr_f32_7F
 };
 
+const tft_font_t tft_font_f32 = 
+{
+    .id = TFT_FONT_32, .chrtbl = chrtbl_f32, .widtbl = widtbl_f32,
+    .first = firstchr_f32, .count = nr_chrs_f32, .height = chr_hgt_f32,
+    .gap = -3, .scale = 1, .format = TFT_FONT_FMT_FIXED
+};
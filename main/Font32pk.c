@@ -0,0 +1,299 @@
+// Font size 32, bounding box packed. Generated by tools/fontgen, do not edit.
+
+#include <stdlib.h>
+
+#include "tft_fonts.h"
+
+const unsigned char fontpk_f32_bits[2164] = 
+{
+    0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x99, 0x99, 0x99, 0x90, 0x01, 0x98, 0x02,
+    0x20, 0x04, 0x40, 0x19, 0x80, 0x22, 0x00, 0x44, 0x1F, 0xFF, 0x82, 0x20,
+    0x04, 0x40, 0x08, 0x83, 0xFF, 0xF0, 0x44, 0x00, 0x88, 0x03, 0x30, 0x04,
+    0x40, 0x08, 0x80, 0x33, 0x00, 0x1F, 0x87, 0xFE, 0x70, 0xEC, 0x03, 0xC0,
+    0x3C, 0x00, 0xE0, 0x06, 0x00, 0xFF, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
+    0x06, 0x00, 0x7F, 0x1F, 0xFF, 0xC1, 0xE0, 0x1C, 0x03, 0x07, 0xF0, 0x20,
+    0x63, 0x06, 0x0C, 0x18, 0xC0, 0xC1, 0x88, 0x0C, 0x19, 0x80, 0x63, 0x10,
+    0x07, 0xF2, 0x00, 0x1C, 0x63, 0x80, 0x04, 0xFE, 0x00, 0x8C, 0x60, 0x19,
+    0x83, 0x01, 0x18, 0x30, 0x31, 0x83, 0x06, 0x0C, 0x60, 0x40, 0xFE, 0x0C,
+    0x03, 0x80, 0x80, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x38, 0xE0, 0x30, 0x60,
+    0x30, 0x60, 0x30, 0xE0, 0x19, 0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x3F, 0x0C,
+    0x73, 0x8C, 0xE1, 0xCC, 0xC0, 0xF8, 0xC0, 0x78, 0xC0, 0x30, 0xE0, 0xFC,
+    0x7F, 0xCE, 0x3F, 0x07, 0xFF, 0x97, 0x80, 0x18, 0x8C, 0x46, 0x31, 0x98,
+    0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC3, 0x18, 0xC2, 0x18, 0x43, 0xC2, 0x18,
+    0x43, 0x18, 0xC3, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x19, 0x8C, 0x0C, 0x03,
+    0x00, 0xC1, 0x32, 0xFF, 0xCF, 0xC1, 0xE0, 0xCC, 0x73, 0x88, 0x40, 0x01,
+    0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40,
+    0x7F, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
+    0x20, 0x00, 0x40, 0x00, 0xFF, 0x96, 0xB0, 0xFF, 0xF0, 0xFF, 0x80, 0x03,
+    0x03, 0x02, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0x10, 0x30,
+    0x30, 0x20, 0x60, 0x60, 0x40, 0xC0, 0xC0, 0x0F, 0x03, 0xFC, 0x79, 0xE6,
+    0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+    0x03, 0xE0, 0x76, 0x06, 0x79, 0xE3, 0xFC, 0x0F, 0x00, 0x0C, 0x31, 0xFF,
+    0xFC, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x1F, 0x87,
+    0xFE, 0x70, 0xEE, 0x03, 0xC0, 0x3C, 0x03, 0x00, 0x30, 0x07, 0x01, 0xE0,
+    0x7C, 0x1F, 0x03, 0xC0, 0x70, 0x0E, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0,
+    0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x60, 0x06, 0x00, 0xE0, 0x7C,
+    0x07, 0xE0, 0x07, 0x00, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE7, 0xFE,
+    0x1F, 0x80, 0x00, 0xC0, 0x1C, 0x03, 0xC0, 0x3C, 0x06, 0xC0, 0xCC, 0x18,
+    0xC1, 0x8C, 0x30, 0xC6, 0x0C, 0xC0, 0xCF, 0xFF, 0xFF, 0xF0, 0x0C, 0x00,
+    0xC0, 0x0C, 0x00, 0xC0, 0x7F, 0xE7, 0xFE, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0xF8, 0x7F, 0xEF, 0x0E, 0xC0, 0x70, 0x03, 0x00, 0x30, 0x03, 0xC0, 0x3E,
+    0x07, 0x70, 0xE7, 0xFE, 0x1F, 0x80, 0x0F, 0x83, 0xFE, 0x70, 0x66, 0x03,
+    0x60, 0x3C, 0x00, 0xCF, 0x8F, 0xFE, 0xF0, 0xEE, 0x07, 0xC0, 0x3C, 0x03,
+    0xC0, 0x36, 0x07, 0x70, 0xE3, 0xFE, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0x00,
+    0x60, 0x0E, 0x01, 0xC0, 0x18, 0x03, 0x80, 0x30, 0x06, 0x00, 0x60, 0x0E,
+    0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x00, 0x0F, 0x03,
+    0xFC, 0x30, 0xC6, 0x06, 0x60, 0x66, 0x06, 0x30, 0xC1, 0xF8, 0x3F, 0xC7,
+    0x0E, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x70, 0xE7, 0xFE, 0x1F, 0x80,
+    0x1F, 0x87, 0xFC, 0x70, 0xEE, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07,
+    0x70, 0xF7, 0xFF, 0x1F, 0x30, 0x03, 0xC0, 0x6C, 0x06, 0x60, 0xE7, 0xFC,
+    0x3F, 0x80, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x03, 0xFE,
+    0x5A, 0xC0, 0x00, 0x04, 0x00, 0x70, 0x0F, 0x00, 0xE0, 0x1E, 0x01, 0xC0,
+    0x0C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00,
+    0x04, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x80,
+    0x03, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xC0,
+    0x0E, 0x01, 0xE0, 0x1C, 0x03, 0xC0, 0x38, 0x00, 0x80, 0x00, 0x1F, 0x8F,
+    0xF9, 0xC3, 0xF0, 0x3C, 0x07, 0x80, 0xC0, 0x38, 0x0E, 0x03, 0x80, 0xE0,
+    0x18, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x00,
+    0xFF, 0x80, 0x07, 0x01, 0xC0, 0x38, 0x00, 0xC0, 0xC0, 0x00, 0xC3, 0x00,
+    0x00, 0xC4, 0x07, 0x90, 0xD8, 0x31, 0xE1, 0xB0, 0xC1, 0x83, 0xC1, 0x83,
+    0x07, 0x86, 0x06, 0x0F, 0x0C, 0x0C, 0x1E, 0x18, 0x30, 0x6C, 0x30, 0x60,
+    0xD8, 0x60, 0xC3, 0x18, 0x63, 0x8C, 0x30, 0x79, 0xF0, 0x30, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x38, 0x1E, 0x00, 0x1F, 0xE0, 0x00,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60,
+    0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xF8,
+    0x3F, 0xFC, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x06, 0x60, 0x06, 0xE0, 0x07,
+    0xFF, 0xE3, 0xFF, 0xEC, 0x03, 0xB0, 0x06, 0xC0, 0x1B, 0x00, 0x6C, 0x01,
+    0xB0, 0x0E, 0xFF, 0xE3, 0xFF, 0xEC, 0x03, 0xB0, 0x03, 0xC0, 0x0F, 0x00,
+    0x3C, 0x00, 0xF0, 0x0E, 0xFF, 0xFB, 0xFF, 0x80, 0x07, 0xF0, 0x1F, 0xFC,
+    0x3C, 0x1E, 0x70, 0x06, 0x60, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x03, 0xE0, 0x03, 0x60, 0x07,
+    0x70, 0x06, 0x3C, 0x1E, 0x1F, 0xFC, 0x07, 0xF0, 0xFF, 0xC1, 0xFF, 0xE3,
+    0x01, 0xE6, 0x00, 0xEC, 0x00, 0xD8, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+    0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xB0, 0x07,
+    0x60, 0x3C, 0xFF, 0xF1, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x80,
+    0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xFF, 0xF7, 0xFF, 0xB0, 0x01,
+    0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+    0xFF, 0xEF, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+    0xC0, 0x0C, 0x00, 0x07, 0xF0, 0x1F, 0xFC, 0x38, 0x1E, 0x70, 0x06, 0x60,
+    0x07, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x03, 0xC0, 0x03, 0xE0, 0x03, 0x60, 0x07, 0x70, 0x0F, 0x3C, 0x1F, 0x1F,
+    0xFB, 0x07, 0xE1, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+    0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+    0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x07, 0x80, 0xF0,
+    0x1F, 0x07, 0x7F, 0xC7, 0xF0, 0xC0, 0x1D, 0x80, 0x73, 0x01, 0xC6, 0x07,
+    0x0C, 0x1C, 0x18, 0x70, 0x31, 0xC0, 0x67, 0x00, 0xDE, 0x01, 0xFE, 0x03,
+    0xCE, 0x07, 0x0E, 0x0C, 0x0C, 0x18, 0x1C, 0x30, 0x1C, 0x60, 0x1C, 0xC0,
+    0x1D, 0x80, 0x1C, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+    0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06,
+    0x00, 0xFF, 0xFF, 0xFC, 0xE0, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00,
+    0xFD, 0x80, 0xDE, 0xC0, 0x6F, 0x60, 0x37, 0x98, 0x33, 0xCC, 0x19, 0xE6,
+    0x0C, 0xF1, 0x8C, 0x78, 0xC6, 0x3C, 0x63, 0x1E, 0x1B, 0x0F, 0x0D, 0x87,
+    0x87, 0xC3, 0xC1, 0xC1, 0xE0, 0xE0, 0xC0, 0xE0, 0x0F, 0x80, 0x3F, 0x00,
+    0xFE, 0x03, 0xD8, 0x0F, 0x70, 0x3C, 0xE0, 0xF1, 0x83, 0xC7, 0x0F, 0x0E,
+    0x3C, 0x18, 0xF0, 0x73, 0xC0, 0xEF, 0x01, 0xBC, 0x07, 0xF0, 0x0F, 0xC0,
+    0x1F, 0x00, 0x70, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0x07, 0x8E, 0x00, 0xE6,
+    0x00, 0x37, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+    0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x3B, 0x00, 0x19, 0xC0, 0x1C, 0x78,
+    0x3C, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0xE7, 0xFF, 0xB0, 0x0F, 0x80,
+    0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xFF, 0xF7, 0xFF, 0x30, 0x01,
+    0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x00,
+    0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0x07, 0x8E, 0x00, 0xE6, 0x00, 0x37, 0x00,
+    0x1F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78,
+    0x00, 0x3E, 0x02, 0x3B, 0x03, 0x99, 0xC0, 0xFC, 0x78, 0x3C, 0x1F, 0xFF,
+    0x03, 0xF9, 0xC0, 0x00, 0x40, 0xFF, 0xF3, 0xFF, 0xEC, 0x01, 0xF0, 0x03,
+    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x06, 0xFF, 0xFB, 0xFF, 0xCC, 0x03,
+    0xB0, 0x06, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
+    0x30, 0x0F, 0xC0, 0xFF, 0xC7, 0x03, 0x98, 0x06, 0x60, 0x19, 0x80, 0x77,
+    0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0xE0, 0x0D,
+    0x80, 0x36, 0x00, 0xDE, 0x07, 0x3F, 0xF8, 0x3F, 0x80, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03,
+    0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+    0xC0, 0x03, 0x00, 0x0C, 0x00, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xDC, 0x0E, 0x3F, 0xF0, 0x7F,
+    0x80, 0xE0, 0x0E, 0xC0, 0x19, 0x80, 0x33, 0x00, 0x63, 0x01, 0x86, 0x03,
+    0x0C, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x31, 0x80, 0x63, 0x00,
+    0xC6, 0x00, 0xD8, 0x01, 0xB0, 0x03, 0xE0, 0x03, 0x80, 0x07, 0x00, 0xE0,
+    0x38, 0x0E, 0xC0, 0x70, 0x19, 0x80, 0xE0, 0x33, 0x83, 0x60, 0xE3, 0x06,
+    0xC1, 0x86, 0x0D, 0x83, 0x0C, 0x1B, 0x06, 0x1C, 0x63, 0x1C, 0x18, 0xC6,
+    0x30, 0x31, 0x8C, 0x60, 0x63, 0x18, 0xC0, 0xEC, 0x1B, 0x80, 0xD8, 0x36,
+    0x01, 0xB0, 0x6C, 0x03, 0x60, 0xD8, 0x07, 0x80, 0xF0, 0x07, 0x01, 0xC0,
+    0x0E, 0x03, 0x80, 0x60, 0x0C, 0xE0, 0x38, 0xC0, 0x60, 0xC1, 0x81, 0xC7,
+    0x01, 0x8C, 0x01, 0xB0, 0x03, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x1B, 0x00,
+    0x77, 0x00, 0xC6, 0x03, 0x06, 0x0E, 0x0E, 0x18, 0x0C, 0x70, 0x1D, 0xC0,
+    0x1C, 0xE0, 0x07, 0x70, 0x0E, 0x30, 0x0C, 0x38, 0x1C, 0x18, 0x18, 0x0C,
+    0x30, 0x0E, 0x70, 0x06, 0x60, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x7F, 0xFD, 0xFF, 0xF0, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x01, 0x80,
+    0x0C, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x60, 0x03, 0x00, 0x1C, 0x00,
+    0xE0, 0x07, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF1, 0x8C,
+    0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x7F, 0xE0,
+    0x80, 0x40, 0x30, 0x08, 0x04, 0x03, 0x00, 0x80, 0x40, 0x30, 0x08, 0x04,
+    0x03, 0x00, 0x80, 0x40, 0x30, 0x08, 0x04, 0x03, 0x00, 0x80, 0x40, 0x30,
+    0x08, 0x04, 0x03, 0x00, 0x80, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+    0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0xFF, 0xE0, 0x03, 0x80, 0x0D, 0x80,
+    0x31, 0x80, 0xC1, 0x83, 0x01, 0x8C, 0x01, 0xB0, 0x01, 0x80, 0xFF, 0xF8,
+    0x7A, 0x7F, 0xC0, 0x1F, 0x83, 0xFE, 0x18, 0x38, 0xC0, 0xC0, 0x06, 0x0F,
+    0xF1, 0xFF, 0x9C, 0x0C, 0xC0, 0x66, 0x03, 0x38, 0x78, 0xFE, 0xF3, 0xE3,
+    0x80, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0xF0, 0xDF, 0xCF,
+    0x9E, 0xE0, 0x6C, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xE0, 0x6F,
+    0x9E, 0xDF, 0xCC, 0xF0, 0x0F, 0x07, 0xF9, 0xE7, 0x30, 0x3E, 0x01, 0x80,
+    0x30, 0x06, 0x00, 0xE0, 0x6C, 0x0D, 0xE7, 0x1F, 0xE0, 0xF0, 0x00, 0x30,
+    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0xF3, 0x3F, 0xB7, 0x9F, 0x60, 0x7E,
+    0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x60, 0x77, 0x9F, 0x3F, 0xB0,
+    0xF3, 0x0F, 0x03, 0xFC, 0x79, 0xE6, 0x06, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC,
+    0x00, 0xE0, 0x06, 0x07, 0x79, 0xE3, 0xFC, 0x0F, 0x00, 0x1E, 0x7C, 0xC1,
+    0x83, 0x1F, 0xFF, 0x98, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30,
+    0x60, 0x0F, 0x33, 0xFB, 0x79, 0xF6, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+    0x03, 0xE0, 0x36, 0x07, 0x79, 0xF3, 0xFB, 0x0F, 0x30, 0x03, 0xC0, 0x3C,
+    0x07, 0x70, 0xE7, 0xFE, 0x1F, 0x80, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x9F, 0x37, 0xF7, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+    0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0C, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0,
+    0x33, 0x30, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE,
+    0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC1, 0xF0, 0xEC, 0x73, 0x38, 0xDC, 0x3F,
+    0x0F, 0xE3, 0x98, 0xC7, 0x30, 0xCC, 0x3B, 0x06, 0xC1, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xCF, 0x0F, 0x37, 0xEF, 0xEF, 0x1F, 0x1F, 0x83, 0x83,
+    0xC0, 0xC0, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03, 0xC0, 0xC0, 0xF0,
+    0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03, 0xC0, 0xC0, 0xC0, 0xCF, 0x9B, 0xFB,
+    0xC3, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+    0xE0, 0x3C, 0x06, 0x0F, 0x81, 0xFF, 0x1E, 0x3C, 0xC0, 0x6E, 0x03, 0xE0,
+    0x0F, 0x00, 0x78, 0x03, 0xE0, 0x3B, 0x01, 0x9E, 0x3C, 0x7F, 0xC0, 0xF8,
+    0x00, 0xCF, 0x0D, 0xFC, 0xF9, 0xEE, 0x06, 0xC0, 0x7C, 0x03, 0xC0, 0x3C,
+    0x03, 0xC0, 0x7E, 0x06, 0xF9, 0xED, 0xFC, 0xCF, 0x0C, 0x00, 0xC0, 0x0C,
+    0x00, 0xC0, 0x0C, 0x00, 0x0F, 0x33, 0xFB, 0x79, 0xF6, 0x07, 0xE0, 0x3C,
+    0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x36, 0x07, 0x79, 0xF3, 0xFB, 0x0F, 0x30,
+    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xDF, 0xFE, 0x30, 0xC3, 0x0C,
+    0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0x1F,
+    0x03, 0xF8, 0x1F, 0x00, 0xF0, 0x3E, 0x1D, 0xFE, 0x3F, 0x00, 0x30, 0xC3,
+    0x0C, 0xFF, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0x1C, 0xC0,
+    0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+    0x1F, 0x87, 0xBF, 0xB3, 0xE6, 0xC0, 0x78, 0x0D, 0x83, 0x30, 0x66, 0x0C,
+    0x63, 0x0C, 0x61, 0x8C, 0x1B, 0x03, 0x60, 0x7C, 0x07, 0x00, 0xE0, 0xC1,
+    0xC1, 0xE0, 0xE0, 0xF0, 0x50, 0x6C, 0x6C, 0x66, 0x36, 0x33, 0x1B, 0x19,
+    0x88, 0x8C, 0x6C, 0x6C, 0x36, 0x36, 0x1B, 0x1B, 0x07, 0x07, 0x03, 0x83,
+    0x81, 0xC1, 0xC0, 0xC0, 0x7C, 0x1D, 0x83, 0x18, 0xC3, 0xB8, 0x3E, 0x03,
+    0x80, 0xF8, 0x3B, 0x86, 0x31, 0x83, 0x70, 0x7C, 0x06, 0xE0, 0x3B, 0x01,
+    0x98, 0x0C, 0x60, 0xC3, 0x06, 0x18, 0x30, 0x63, 0x03, 0x18, 0x18, 0xC0,
+    0x6C, 0x03, 0x60, 0x1B, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xC0, 0x0E,
+    0x03, 0xE0, 0x1E, 0x00, 0xFF, 0xFF, 0xF0, 0x1C, 0x0E, 0x07, 0x03, 0x80,
+    0xC0, 0x70, 0x38, 0x1C, 0x0E, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0x1C, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0xE0, 0x30, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x0C, 0x07, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0x3C, 0x02, 0xCC, 0x07, 0x0E, 0x1C,
+    0x06, 0x68, 0x07, 0x80,
+};
+
+const tft_gfx_glyph_t fontpk_f32_glyphs[96] = 
+{
+    {     0,   0,   0,   8,   0,   0 },   // 0x20
+    {     0,   2,  18,  11,   3,   1 },   // 0x21
+    {     5,   4,   7,  11,   2,   1 },   // 0x22
+    {     9,  15,  17,  22,   2,   2 },   // 0x23
+    {    41,  12,  17,  17,   1,   2 },   // 0x24
+    {    67,  20,  18,  24,   1,   2 },   // 0x25
+    {   112,  16,  18,  20,   1,   1 },   // 0x26
+    {   148,   3,   6,   9,   1,   1 },   // 0x27
+    {   151,   5,  24,  11,   3,   1 },   // 0x28
+    {   166,   5,  19,  11,   0,   7 },   // 0x29
+    {   178,  10,  10,  15,   1,   1 },   // 0x2A
+    {   191,  15,  15,  28,   5,   4 },   // 0x2B
+    {   220,   3,   7,  10,   2,  16 },   // 0x2C
+    {   223,   6,   2,  11,   1,  11 },   // 0x2D
+    {   225,   3,   3,  10,   2,  16 },   // 0x2E
+    {   227,   8,  20,  11,   0,   1 },   // 0x2F
+    {   247,  12,  17,  17,   1,   2 },   // 0x30
+    {   273,   6,  17,  17,   3,   2 },   // 0x31
+    {   286,  12,  17,  17,   1,   2 },   // 0x32
+    {   312,  12,  17,  17,   1,   2 },   // 0x33
+    {   338,  12,  17,  17,   1,   2 },   // 0x34
+    {   364,  12,  17,  17,   1,   2 },   // 0x35
+    {   390,  12,  17,  17,   1,   2 },   // 0x36
+    {   416,  12,  17,  17,   1,   2 },   // 0x37
+    {   442,  12,  17,  17,   1,   2 },   // 0x38
+    {   468,  12,  17,  17,   1,   2 },   // 0x39
+    {   494,   3,  13,  10,   2,   6 },   // 0x3A
+    {   499,   3,  17,  10,   2,   6 },   // 0x3B
+    {   506,  14,  13,  28,   5,   5 },   // 0x3C
+    {   529,  15,   5,  28,   5,   9 },   // 0x3D
+    {   539,  14,  13,  28,   6,   5 },   // 0x3E
+    {   562,  11,  18,  16,   1,   1 },   // 0x3F
+    {   587,  23,  21,  28,   1,   1 },   // 0x40
+    {   648,  16,  18,  19,   0,   1 },   // 0x41
+    {   684,  14,  18,  20,   2,   1 },   // 0x42
+    {   716,  16,  18,  21,   1,   1 },   // 0x43
+    {   752,  15,  18,  21,   2,   1 },   // 0x44
+    {   786,  13,  18,  19,   2,   1 },   // 0x45
+    {   816,  12,  18,  18,   2,   1 },   // 0x46
+    {   843,  16,  18,  22,   1,   1 },   // 0x47
+    {   879,  14,  18,  21,   2,   1 },   // 0x48
+    {   911,   2,  18,   9,   2,   1 },   // 0x49
+    {   916,  11,  18,  16,   0,   1 },   // 0x4A
+    {   941,  15,  18,  20,   2,   1 },   // 0x4B
+    {   975,  11,  18,  16,   2,   1 },   // 0x4C
+    {  1000,  17,  18,  24,   2,   1 },   // 0x4D
+    {  1039,  14,  18,  21,   2,   1 },   // 0x4E
+    {  1071,  17,  18,  22,   1,   1 },   // 0x4F
+    {  1110,  13,  18,  19,   2,   1 },   // 0x50
+    {  1140,  17,  19,  22,   1,   1 },   // 0x51
+    {  1181,  14,  18,  20,   2,   1 },   // 0x52
+    {  1213,  14,  18,  19,   1,   1 },   // 0x53
+    {  1245,  14,  18,  17,   0,   1 },   // 0x54
+    {  1277,  14,  18,  21,   2,   1 },   // 0x55
+    {  1309,  15,  18,  18,   0,   1 },   // 0x56
+    {  1343,  23,  18,  26,   0,   1 },   // 0x57
+    {  1395,  15,  18,  18,   0,   1 },   // 0x58
+    {  1429,  16,  18,  19,   0,   1 },   // 0x59
+    {  1465,  14,  18,  19,   1,   1 },   // 0x5A
+    {  1497,   5,  23,  12,   3,   1 },   // 0x5B
+    {  1512,   9,  25,  16,   2,   0 },   // 0x5C
+    {  1541,   5,  23,  12,   1,   1 },   // 0x5D
+    {  1556,  15,   7,  28,   5,   1 },   // 0x5E
+    {  1570,  13,   1,  16,   0,  24 },   // 0x5F
+    {  1572,   3,   6,   9,   1,   1 },   // 0x60
+    {  1575,  13,  13,  17,   1,   6 },   // 0x61
+    {  1597,  12,  18,  18,   2,   1 },   // 0x62
+    {  1624,  11,  13,  16,   1,   6 },   // 0x63
+    {  1642,  12,  18,  18,   1,   1 },   // 0x64
+    {  1669,  12,  13,  17,   1,   6 },   // 0x65
+    {  1689,   7,  18,  11,   0,   1 },   // 0x66
+    {  1705,  12,  19,  18,   1,   6 },   // 0x67
+    {  1734,  11,  18,  18,   2,   1 },   // 0x68
+    {  1759,   2,  18,   9,   2,   1 },   // 0x69
+    {  1764,   4,  24,   9,   0,   1 },   // 0x6A
+    {  1776,  10,  17,  15,   2,   2 },   // 0x6B
+    {  1798,   2,  18,   9,   2,   1 },   // 0x6C
+    {  1803,  18,  13,  25,   2,   6 },   // 0x6D
+    {  1833,  11,  13,  18,   2,   6 },   // 0x6E
+    {  1851,  13,  13,  18,   1,   6 },   // 0x6F
+    {  1873,  12,  18,  18,   2,   6 },   // 0x70
+    {  1900,  12,  18,  18,   1,   6 },   // 0x71
+    {  1927,   6,  13,  11,   2,   6 },   // 0x72
+    {  1937,  10,  13,  15,   1,   6 },   // 0x73
+    {  1954,   6,  17,  10,   0,   2 },   // 0x74
+    {  1967,  11,  13,  17,   2,   6 },   // 0x75
+    {  1985,  11,  13,  15,   0,   6 },   // 0x76
+    {  2003,  17,  13,  21,   0,   6 },   // 0x77
+    {  2031,  11,  13,  16,   1,   6 },   // 0x78
+    {  2049,  13,  19,  16,   0,   6 },   // 0x79
+    {  2080,  10,  13,  15,   1,   6 },   // 0x7A
+    {  2097,   8,  25,  16,   3,   0 },   // 0x7B
+    {  2122,   2,  25,  16,   5,   0 },   // 0x7C
+    {  2129,   8,  25,  16,   2,   0 },   // 0x7D
+    {  2154,  15,   5,  28,   5,   1 },   // 0x7E
+    {  2164,   0,   0,   4,   0,   0 },   // 0x7F
+};
+
+const tft_font_t tft_font_f32pk = 
+{
+    .id = TFT_FONT_32, .first = 32, .count = 96, .height = 26,
+    .gap = -3, .scale = 1, .format = TFT_FONT_FMT_GFX,
+    .bitmap = fontpk_f32_bits, .glyphs = fontpk_f32_glyphs
+};
+
+// EOF
@@ -337,3 +337,18 @@ const unsigned char * chrtbl_f64[96] =        // character pointer table
         chr_f64_20, chr_f64_20, chr_f64_20, chr_f64_20, chr_f64_20, chr_f64_20, chr_f64_20, chr_f64_20
 };
 
+const tft_font_t tft_font_f64 = 
+{
+    .id = TFT_FONT_64, .chrtbl = chrtbl_f64, .widtbl = widtbl_f64,
+    .first = firstchr_f64, .count = nr_chrs_f64, .height = chr_hgt_f64,
+    .gap = -3, .scale = 1, .format = TFT_FONT_FMT_FIXED
+};
+
+// Fake larger font by duplicating pixels
+
+const tft_font_t tft_font_f128 = 
+{
+    .id = TFT_FONT_128, .chrtbl = chrtbl_f64, .widtbl = widtbl_f64,
+    .first = firstchr_f64, .count = nr_chrs_f64, .height = chr_hgt_f64,
+    .gap = -3, .scale = 2, .format = TFT_FONT_FMT_FIXED
+};
@@ -0,0 +1,239 @@
+// Font size 64, bounding box packed. Generated by tools/fontgen, do not edit.
+
+#include <stdlib.h>
+
+#include "tft_fonts.h"
+
+const unsigned char fontpk_f64_bits[1334] = 
+{
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x3E, 0x00, 0x7C, 0x3C, 0x00,
+    0x3C, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00,
+    0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x78, 0x00,
+    0x1E, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0x3E, 0x00,
+    0x7C, 0x3F, 0x81, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF,
+    0xE0, 0x00, 0xFF, 0x00, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x00, 0xF0, 0x0F,
+    0x80, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x1E, 0x00, 0xF0,
+    0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+    0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E,
+    0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+    0x1E, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xC1, 0xF8, 0x1F, 0xC7, 0xC0, 0x0F, 0x8F, 0x80, 0x0F, 0x1E, 0x00, 0x1F,
+    0x7C, 0x00, 0x1E, 0xF0, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xC0, 0x00, 0xF0,
+    0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
+    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07,
+    0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
+    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00,
+    0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
+    0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x3E, 0x00, 0x7C,
+    0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E,
+    0x78, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xF8,
+    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E,
+    0x3F, 0x81, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0,
+    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3D, 0xE0,
+    0x00, 0x3D, 0xE0, 0x00, 0x79, 0xE0, 0x00, 0xF1, 0xE0, 0x01, 0xF1, 0xE0,
+    0x01, 0xE1, 0xE0, 0x03, 0xC1, 0xE0, 0x07, 0x81, 0xE0, 0x0F, 0x81, 0xE0,
+    0x0F, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x3E, 0x01, 0xE0, 0x3C, 0x01, 0xE0,
+    0x78, 0x01, 0xE0, 0xF0, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x1F, 0xFF, 0xF8,
+    0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xC0, 0x00, 0x07,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0xE0, 0x00, 0x03, 0xC7, 0xF8, 0x07, 0xBF, 0xFC, 0x0F, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xFC, 0x3F, 0x81, 0xFC, 0x7C, 0x00, 0xFC, 0xF0, 0x00,
+    0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
+    0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x00, 0xFF, 0x80, 0x01, 0xEF, 0x80, 0x07, 0xCF, 0x80, 0x1F, 0x9F,
+    0xC0, 0xFE, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x07,
+    0xF8, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xF8, 0x1F, 0xC0, 0xFC, 0x3F, 0x00, 0x3E, 0x3E, 0x00, 0x1E, 0x3C,
+    0x00, 0x1F, 0x7C, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0xF1, 0xFF, 0xE0, 0xF7,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0x81, 0xFC, 0xFE, 0x00, 0x7C, 0xFC,
+    0x00, 0x3E, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x78,
+    0x00, 0x1F, 0x78, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7E, 0x3F,
+    0x81, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+    0x78, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+    0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x78, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x3E, 0x00, 0x7C, 0x7C, 0x00,
+    0x3E, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00,
+    0x1E, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x81,
+    0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xF8, 0x3F, 0x00, 0xFC, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x1E, 0xF8, 0x00,
+    0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0x7C, 0x00,
+    0x3E, 0x7F, 0x00, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xF0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x7E, 0x00, 0x7C, 0x7C, 0x00,
+    0x3E, 0x78, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
+    0x1F, 0x78, 0x00, 0x1F, 0x7C, 0x00, 0x3F, 0x3E, 0x00, 0x7F, 0x3F, 0x81,
+    0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xEF, 0x07, 0xFF, 0x8F, 0x00, 0xFE,
+    0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0xF0, 0x00,
+    0x1E, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x3C, 0x78, 0x00, 0x7C, 0x7C, 0x00,
+    0xFC, 0x3F, 0x03, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF,
+    0x80, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
+    0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0x01, 0xF8, 0x7C, 0x00, 0x7C,
+    0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x7C, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC,
+    0x3F, 0xFF, 0x3C, 0x7F, 0xC0, 0x3C, 0x7C, 0x00, 0x3C, 0xF8, 0x00, 0x3C,
+    0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0xFC,
+    0xF8, 0x01, 0xFC, 0x7C, 0x07, 0xFF, 0x7F, 0xFF, 0x9F, 0x3F, 0xFF, 0x1F,
+    0x1F, 0xFC, 0x0F, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x0F, 0x1F,
+    0xF8, 0x3F, 0xF8, 0xF7, 0xFF, 0xC7, 0xFF, 0xCF, 0x7F, 0xFE, 0xFF, 0xFE,
+    0xFF, 0x03, 0xFF, 0x03, 0xEF, 0xC0, 0x1F, 0xC0, 0x1F, 0xF8, 0x00, 0xF8,
+    0x00, 0xFF, 0x80, 0x0F, 0x80, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0xF1,
+    0xFF, 0xE0, 0xF3, 0xFF, 0xF0, 0xF7, 0xFF, 0xF8, 0xFF, 0x81, 0xFC, 0xFE,
+    0x00, 0x7C, 0xFC, 0x00, 0x3E, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0xF8,
+    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x3E, 0xFC,
+    0x00, 0x3E, 0xFE, 0x00, 0x7C, 0xFF, 0x81, 0xFC, 0xF7, 0xFF, 0xF8, 0xF3,
+    0xFF, 0xF0, 0xF1, 0xFF, 0xE0, 0xF0, 0x7F, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+    0x00, 0x00,
+};
+
+const tft_gfx_glyph_t fontpk_f64_glyphs[96] = 
+{
+    {     0,   0,   0,  15,   0,   0 },   // 0x20
+    {     0,   0,   0,  15,   0,   0 },   // 0x21
+    {     0,   0,   0,  15,   0,   0 },   // 0x22
+    {     0,   0,   0,  15,   0,   0 },   // 0x23
+    {     0,   0,   0,  15,   0,   0 },   // 0x24
+    {     0,   0,   0,  15,   0,   0 },   // 0x25
+    {     0,   0,   0,  15,   0,   0 },   // 0x26
+    {     0,   0,   0,  15,   0,   0 },   // 0x27
+    {     0,   0,   0,  15,   0,   0 },   // 0x28
+    {     0,   0,   0,  15,   0,   0 },   // 0x29
+    {     0,   0,   0,  15,   0,   0 },   // 0x2A
+    {     0,   0,   0,  15,   0,   0 },   // 0x2B
+    {     0,   0,   0,  15,   0,   0 },   // 0x2C
+    {     0,   0,   0,  15,   0,   0 },   // 0x2D
+    {     0,   5,   5,  18,   5,  31 },   // 0x2E
+    {     4,   0,   0,  15,   0,   0 },   // 0x2F
+    {     4,  24,  36,  30,   1,   1 },   // 0x30
+    {   112,  13,  35,  30,   5,   1 },   // 0x31
+    {   169,  23,  35,  30,   2,   1 },   // 0x32
+    {   270,  24,  35,  30,   1,   1 },   // 0x33
+    {   375,  24,  34,  30,   1,   2 },   // 0x34
+    {   477,  23,  35,  30,   2,   2 },   // 0x35
+    {   578,  24,  36,  30,   1,   1 },   // 0x36
+    {   686,  23,  34,  30,   2,   2 },   // 0x37
+    {   784,  24,  36,  30,   1,   1 },   // 0x38
+    {   892,  24,  36,  30,   1,   1 },   // 0x39
+    {  1000,   5,  22,  18,   5,  10 },   // 0x3A
+    {  1014,   0,   0,  15,   0,   0 },   // 0x3B
+    {  1014,   0,   0,  15,   0,   0 },   // 0x3C
+    {  1014,   0,   0,  15,   0,   0 },   // 0x3D
+    {  1014,   0,   0,  15,   0,   0 },   // 0x3E
+    {  1014,   0,   0,  15,   0,   0 },   // 0x3F
+    {  1014,   0,   0,  15,   0,   0 },   // 0x40
+    {  1014,   0,   0,  15,   0,   0 },   // 0x41
+    {  1014,   0,   0,  15,   0,   0 },   // 0x42
+    {  1014,   0,   0,  15,   0,   0 },   // 0x43
+    {  1014,   0,   0,  15,   0,   0 },   // 0x44
+    {  1014,   0,   0,  15,   0,   0 },   // 0x45
+    {  1014,   0,   0,  15,   0,   0 },   // 0x46
+    {  1014,   0,   0,  15,   0,   0 },   // 0x47
+    {  1014,   0,   0,  15,   0,   0 },   // 0x48
+    {  1014,   0,   0,  15,   0,   0 },   // 0x49
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4A
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4B
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4C
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4D
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4E
+    {  1014,   0,   0,  15,   0,   0 },   // 0x4F
+    {  1014,   0,   0,  15,   0,   0 },   // 0x50
+    {  1014,   0,   0,  15,   0,   0 },   // 0x51
+    {  1014,   0,   0,  15,   0,   0 },   // 0x52
+    {  1014,   0,   0,  15,   0,   0 },   // 0x53
+    {  1014,   0,   0,  15,   0,   0 },   // 0x54
+    {  1014,   0,   0,  15,   0,   0 },   // 0x55
+    {  1014,   0,   0,  15,   0,   0 },   // 0x56
+    {  1014,   0,   0,  15,   0,   0 },   // 0x57
+    {  1014,   0,   0,  15,   0,   0 },   // 0x58
+    {  1014,   0,   0,  15,   0,   0 },   // 0x59
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5A
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5B
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5C
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5D
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5E
+    {  1014,   0,   0,  15,   0,   0 },   // 0x5F
+    {  1014,   0,   0,  15,   0,   0 },   // 0x60
+    {  1014,  24,  28,  30,   2,   9 },   // 0x61
+    {  1098,   0,   0,  15,   0,   0 },   // 0x62
+    {  1098,   0,   0,  15,   0,   0 },   // 0x63
+    {  1098,   0,   0,  15,   0,   0 },   // 0x64
+    {  1098,   0,   0,  15,   0,   0 },   // 0x65
+    {  1098,   0,   0,  15,   0,   0 },   // 0x66
+    {  1098,   0,   0,  15,   0,   0 },   // 0x67
+    {  1098,   0,   0,  15,   0,   0 },   // 0x68
+    {  1098,   0,   0,  15,   0,   0 },   // 0x69
+    {  1098,   0,   0,  15,   0,   0 },   // 0x6A
+    {  1098,   0,   0,  15,   0,   0 },   // 0x6B
+    {  1098,   0,   0,  15,   0,   0 },   // 0x6C
+    {  1098,  36,  27,  45,   3,   9 },   // 0x6D
+    {  1220,   0,   0,  15,   0,   0 },   // 0x6E
+    {  1220,   0,   0,  15,   0,   0 },   // 0x6F
+    {  1220,  24,  38,  32,   3,   9 },   // 0x70
+    {  1334,   0,   0,  15,   0,   0 },   // 0x71
+    {  1334,   0,   0,  15,   0,   0 },   // 0x72
+    {  1334,   0,   0,  15,   0,   0 },   // 0x73
+    {  1334,   0,   0,  15,   0,   0 },   // 0x74
+    {  1334,   0,   0,  15,   0,   0 },   // 0x75
+    {  1334,   0,   0,  15,   0,   0 },   // 0x76
+    {  1334,   0,   0,  15,   0,   0 },   // 0x77
+    {  1334,   0,   0,  15,   0,   0 },   // 0x78
+    {  1334,   0,   0,  15,   0,   0 },   // 0x79
+    {  1334,   0,   0,  15,   0,   0 },   // 0x7A
+    {  1334,   0,   0,  15,   0,   0 },   // 0x7B
+    {  1334,   0,   0,  10,   0,   0 },   // 0x7C
+    {  1334,   0,   0,  15,   0,   0 },   // 0x7D
+    {  1334,   0,   0,  15,   0,   0 },   // 0x7E
+    {  1334,   0,   0,  15,   0,   0 },   // 0x7F
+};
+
+const tft_font_t tft_font_f64pk = 
+{
+    .id = TFT_FONT_64, .first = 32, .count = 96, .height = 48,
+    .gap = -3, .scale = 1, .format = TFT_FONT_FMT_GFX,
+    .bitmap = fontpk_f64_bits, .glyphs = fontpk_f64_glyphs
+};
+
+// Fake larger font by duplicating pixels
+
+const tft_font_t tft_font_f128pk = 
+{
+    .id = TFT_FONT_128, .first = 32, .count = 96, .height = 48,
+    .gap = -3, .scale = 2, .format = TFT_FONT_FMT_GFX,
+    .bitmap = fontpk_f64_bits, .glyphs = fontpk_f64_glyphs
+};
+
+// EOF
@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////////
+// Channel analytics, incremental
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+
+#include "ap_chan.h"
+
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
+#define DB_SPAN     (AP_CHAN_CEIL - AP_CHAN_FLOOR)
+
+// Power of each whole dB above the floor, 10 ^ (db / 10), in tenths of
+// the floor's power. In whole ones the weakest few dB would round alike.
+// Ten steps of one dB, then each decade is ten times the last.
+
+#define LIN(frac, mult)     (((uint64_t)(frac) * (mult) + 500) / 1000)
+#define LIN_DECADE(mult)    LIN(1000, mult), LIN(1259, mult), LIN(1585, mult), \
+                            LIN(1995, mult), LIN(2512, mult), LIN(3162, mult), \
+                            LIN(3981, mult), LIN(5012, mult), LIN(6310, mult), \
+                            LIN(7943, mult)
+
+static const uint64_t lin_tab[] =
+{
+    LIN_DECADE(10ULL),          LIN_DECADE(100ULL),
+    LIN_DECADE(1000ULL),        LIN_DECADE(10000ULL),
+    LIN_DECADE(100000ULL),      LIN_DECADE(1000000ULL),
+    LIN_DECADE(10000000ULL),    LIN_DECADE(100000000ULL),
+    LIN_DECADE(1000000000ULL),  LIN(1000, 10000000000ULL)
+};
+
+_Static_assert(sizeof(lin_tab) / sizeof(lin_tab[0]) == DB_SPAN + 1,
+                    "lin_tab needs one entry per dB from floor to ceiling");
+
+static uint64_t lin(int rssi)
+
+{
+    return lin_tab[MIN(MAX(rssi, AP_CHAN_FLOOR), AP_CHAN_CEIL) - AP_CHAN_FLOOR];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ap_chan_init(ap_chan_t *chan)
+
+{
+    memset(chan, 0, sizeof(*chan));
+}
+
+void ap_chan_add(ap_chan_t *chan, int primary, int rssi, int sign)
+
+{
+    if(primary < 1 || primary > AP_CHAN_MAX)
+        return;
+
+    int64_t pw = (int64_t)lin(rssi) * sign;
+    ap_chan_stat_t *st = &chan->ch[primary];
+
+    st->power += pw;
+    st->count += sign;
+
+    int first = MAX(primary - AP_CHAN_SPREAD, 1);
+    int last = MIN(primary + AP_CHAN_SPREAD, AP_CHAN_MAX);
+    for(int loop = first; loop <= last; loop++)
+        {
+        chan->ch[loop].overlap += pw;
+        chan->ch[loop].overlap_count += sign;
+        }
+    chan->changes++;
+}
+
+int  ap_chan_dbm(uint64_t power)
+
+{
+    int db = 0, extra = 0;
+
+    if(power == 0)
+        return AP_CHAN_FLOOR;
+
+    // Past the table a decade at a time
+    while(power > lin_tab[DB_SPAN])
+        {
+        power /= 10;
+        extra += 10;
+        }
+    while(db < DB_SPAN && lin_tab[db + 1] <= power)
+        db++;
+    return AP_CHAN_FLOOR + db + extra;
+}
+
+// EOF
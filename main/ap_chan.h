@@ -0,0 +1,41 @@
+//////////////////////////////////////////////////////////////////////////
+// Channel analytics. Per 2.4 GHz channel: APs on it, their summed
+// signal power, and the overlap load, the same over all APs within
+// AP_CHAN_SPREAD channels (a 20 MHz signal on N reaches N - 4 .. N + 4).
+// Kept by adding and removing one AP's share as it changes, nothing is
+// recomputed over the table. Power is linear, 10 units = AP_CHAN_FLOOR
+// dBm, so sums are exact and removal undoes addition.
+
+#define AP_CHAN_MAX         14
+#define AP_CHAN_SPREAD      4
+#define AP_CHAN_FLOOR       -100        // dBm of ten power units
+#define AP_CHAN_CEIL        -10         // Stronger counts as this
+
+typedef struct _ap_chan_stat_t
+
+{
+    uint64_t power;                     // APs on the channel
+    uint64_t overlap;                   // APs within the spread
+    uint16_t count, overlap_count;
+
+} ap_chan_stat_t;
+
+typedef struct _ap_chan_t
+
+{
+    ap_chan_stat_t ch[AP_CHAN_MAX + 1]; // [0] unused
+    uint32_t changes;                   // Counts adds and removes
+
+} ap_chan_t;
+
+void ap_chan_init(ap_chan_t *chan);
+
+// One AP's share in (sign 1) or out (sign -1). Channel 0 is nothing.
+
+void ap_chan_add(ap_chan_t *chan, int primary, int rssi, int sign);
+
+// Summed power in dBm, AP_CHAN_FLOOR for none
+
+int  ap_chan_dbm(uint64_t power);
+
+// EOF
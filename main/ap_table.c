@@ -0,0 +1,315 @@
+//////////////////////////////////////////////////////////////////////////
+// AP table, BSSID hash
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+#include "esp_wifi.h"
+
+#include "ap_chan.h"
+#include "ap_table.h"
+
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
+#define SLOT_MASK   (AP_TABLE_SLOTS - 1)
+
+// The low BSSID bytes vary most, the vendor prefix repeats
+
+static int  home_slot(const uint8_t *bssid)
+
+{
+    uint32_t kk = ((uint32_t)bssid[2] << 24) | (bssid[3] << 16) |
+                                    (bssid[4] << 8) | bssid[5];
+
+    kk ^= (bssid[0] << 8) | bssid[1];
+    return (kk * 2654435761U) >> (32 - AP_TABLE_BITS);
+}
+
+// Slot holding the BSSID, or the free slot ending its probe run
+
+static int  probe(ap_table_t *tab, const uint8_t *bssid)
+
+{
+    int idx = home_slot(bssid);
+
+    while(tab->slots[idx].seen)
+        {
+        if(memcmp(tab->slots[idx].bssid, bssid, sizeof(tab->slots[idx].bssid)) == 0)
+            break;
+        idx = (idx + 1) & SLOT_MASK;
+        }
+    return idx;
+}
+
+// Move an entry's share of the channel stats, channel 0 takes it out
+
+static void share(ap_table_t *tab, int id, int primary, int rssi)
+
+{
+    if(tab->share_chan[id] == primary && tab->share_rssi[id] == rssi)
+        return;
+
+    // Churn, as the stats see it
+    if(primary == 0)
+        tab->gone++;
+    else if(tab->share_chan[id] == 0)
+        tab->added++;
+    else
+        tab->moved++;
+    ap_chan_add(&tab->chan, tab->share_chan[id], tab->share_rssi[id], -1);
+    ap_chan_add(&tab->chan, primary, rssi, 1);
+    tab->share_chan[id] = primary;
+    tab->share_rssi[id] = rssi;
+}
+
+// Pull later entries of the run back over the hole, no tombstones
+
+static void remove_slot(ap_table_t *tab, int hole)
+
+{
+    int next = (hole + 1) & SLOT_MASK;
+
+    share(tab, tab->slots[hole].id, 0, 0);
+    tab->free_ids[AP_TABLE_MAX - tab->count] = tab->slots[hole].id;
+    while(tab->slots[next].seen)
+        {
+        int home = home_slot(tab->slots[next].bssid);
+        if(((next - home) & SLOT_MASK) >= ((next - hole) & SLOT_MASK))
+            {
+            tab->slots[hole] = tab->slots[next];
+            hole = next;
+            }
+        next = (next + 1) & SLOT_MASK;
+        }
+    tab->slots[hole].seen = 0;
+    tab->count--;
+}
+
+// Stalest entry, weakest on a tie
+
+static int  stalest(ap_table_t *tab)
+
+{
+    int old = -1;
+
+    for(int loop = 0; loop < AP_TABLE_SLOTS; loop++)
+        {
+        ap_entry_t *ee = &tab->slots[loop];
+        if(!ee->seen)
+            continue;
+        if(old < 0 || ee->last_seen < tab->slots[old].last_seen ||
+                (ee->last_seen == tab->slots[old].last_seen &&
+                            ee->rssi < tab->slots[old].rssi))
+            old = loop;
+        }
+    return old;
+}
+
+// Into the ring. The extremes are kept as samples arrive, only when
+// the one leaving was an extreme is the ring looked over again.
+
+static void hist_push(ap_hist_t *hist, int id, int8_t rssi)
+
+{
+    int8_t *ring = hist->ring[id];
+    int head = hist->head[id];
+
+    if(hist->count[id] < AP_HIST_LEN)
+        {
+        if(hist->count[id]++ == 0)
+            hist->lo[id] = hist->hi[id] = rssi;
+        ring[head] = rssi;
+        }
+    else
+        {
+        int8_t old = ring[head];
+        ring[head] = rssi;
+        if(old == hist->lo[id] || old == hist->hi[id])
+            {
+            hist->lo[id] = hist->hi[id] = rssi;
+            for(int loop = 0; loop < AP_HIST_LEN; loop++)
+                {
+                hist->lo[id] = MIN(hist->lo[id], ring[loop]);
+                hist->hi[id] = MAX(hist->hi[id], ring[loop]);
+                }
+            }
+        }
+    hist->lo[id] = MIN(hist->lo[id], rssi);
+    hist->hi[id] = MAX(hist->hi[id], rssi);
+    hist->head[id] = (head + 1) % AP_HIST_LEN;
+}
+
+// Fast average, trend against the slow one, shown value with hysteresis
+
+static void smooth(ap_entry_t *ee, int8_t rssi)
+
+{
+    int span = MIN(ee->seen, AP_RSSI_EWMA_SPAN);
+    ee->rssi_ewma += (rssi * AP_RSSI_AVG_SCALE - ee->rssi_ewma) / span;
+
+    int diff = ee->rssi_ewma - ee->rssi_avg;
+    if(diff >= AP_RSSI_TREND * AP_RSSI_AVG_SCALE)
+        ee->trend = 1;
+    else if(diff <= -AP_RSSI_TREND * AP_RSSI_AVG_SCALE)
+        ee->trend = -1;
+    else
+        ee->trend = 0;
+
+    int half = ee->rssi_ewma < 0 ? -AP_RSSI_AVG_SCALE / 2 : AP_RSSI_AVG_SCALE / 2;
+    int val = (ee->rssi_ewma + half) / AP_RSSI_AVG_SCALE;
+    if(ee->seen == 1 || abs(val - ee->rssi_shown) >= AP_RSSI_HYST)
+        ee->rssi_shown = val;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ap_table_init(ap_table_t *tab)
+
+{
+    memset(tab, 0, sizeof(*tab));
+    for(int loop = 0; loop < AP_TABLE_MAX; loop++)
+        tab->free_ids[loop] = AP_TABLE_MAX - 1 - loop;
+    ap_chan_init(&tab->chan);
+}
+
+ap_entry_t *ap_table_find(ap_table_t *tab, const uint8_t *bssid)
+
+{
+    int idx = probe(tab, bssid);
+
+    return tab->slots[idx].seen ? &tab->slots[idx] : NULL;
+}
+
+ap_entry_t *ap_table_update(ap_table_t *tab, const wifi_ap_record_t *rec,
+                                uint32_t now)
+
+{
+    int idx = probe(tab, rec->bssid);
+    ap_entry_t *ee = &tab->slots[idx];
+
+    if(!ee->seen)
+        {
+        if(tab->count >= AP_TABLE_MAX)
+            {
+            int old = stalest(tab);
+            if(old < 0)
+                return NULL;
+            remove_slot(tab, old);
+            idx = probe(tab, rec->bssid);
+            ee = &tab->slots[idx];
+            }
+        memset(ee, 0, sizeof(*ee));
+        memcpy(ee->bssid, rec->bssid, sizeof(ee->bssid));
+        ee->id = tab->free_ids[AP_TABLE_MAX - 1 - tab->count];
+        ee->first_seen = now;
+        ee->rssi_min = ee->rssi_max = rec->rssi;
+        tab->hist.head[ee->id] = tab->hist.count[ee->id] = 0;
+        tab->count++;
+        }
+    if(ee->seen < 0xffff)
+        ee->seen++;
+
+    // Plain mean until the span fills, then a running one
+    int span = MIN(ee->seen, AP_RSSI_AVG_SPAN);
+    ee->rssi_avg += (rec->rssi * AP_RSSI_AVG_SCALE - ee->rssi_avg) / span;
+
+    smooth(ee, rec->rssi);
+    hist_push(&tab->hist, ee->id, rec->rssi);
+
+    ee->rssi = rec->rssi;
+    ee->rssi_min = MIN(ee->rssi_min, rec->rssi);
+    ee->rssi_max = MAX(ee->rssi_max, rec->rssi);
+    ee->last_seen = now;
+    ee->missed = 0;
+    ee->primary = rec->primary;
+    ee->authmode = rec->authmode;
+    memcpy(ee->ssid, rec->ssid, sizeof(ee->ssid) - 1);
+    ee->ssid[sizeof(ee->ssid) - 1] = '\0';
+
+    share(tab, ee->id, ee->primary, ee->rssi_shown);
+
+    return ee;
+}
+
+int  ap_table_remove(ap_table_t *tab, const uint8_t *bssid)
+
+{
+    int idx = probe(tab, bssid);
+
+    if(!tab->slots[idx].seen)
+        return false;
+    remove_slot(tab, idx);
+    return true;
+}
+
+int  ap_table_merge(ap_table_t *tab, int chan, const wifi_ap_record_t *recs,
+                                int cnt, uint32_t now)
+
+{
+    for(int loop = 0; loop < AP_TABLE_SLOTS; loop++)
+        {
+        ap_entry_t *ee = &tab->slots[loop];
+        if(ee->seen && ee->primary == chan && ee->missed < 0xff)
+            {
+            // Missed twice is gone, as far as the stats go
+            if(++ee->missed == 2)
+                share(tab, ee->id, 0, 0);
+            }
+        }
+    for(int loop = 0; loop < cnt; loop++)
+        ap_table_update(tab, &recs[loop], now);
+
+    return tab->count;
+}
+
+int  ap_table_age(ap_table_t *tab, uint32_t now, uint32_t max_age)
+
+{
+    int removed = 0;
+
+    // A removal may pull the next entry into this slot, look again
+    for(int loop = 0; loop < AP_TABLE_SLOTS; )
+        {
+        ap_entry_t *ee = &tab->slots[loop];
+        if(ee->seen && now - ee->last_seen > max_age)
+            {
+            remove_slot(tab, loop);
+            removed++;
+            }
+        else
+            loop++;
+        }
+    return removed;
+}
+
+int  ap_table_hist(ap_table_t *tab, const ap_entry_t *ee, int8_t *out, int max)
+
+{
+    int id = ee->id, cnt = MIN(tab->hist.count[id], max);
+    int pos = tab->hist.head[id] - cnt + AP_HIST_LEN;
+
+    for(int loop = 0; loop < cnt; loop++)
+        out[loop] = tab->hist.ring[id][(pos + loop) % AP_HIST_LEN];
+    return cnt;
+}
+
+ap_entry_t *ap_table_next(ap_table_t *tab, int *pos)
+
+{
+    while(*pos < AP_TABLE_SLOTS)
+        {
+        ap_entry_t *ee = &tab->slots[(*pos)++];
+        if(ee->seen)
+            return ee;
+        }
+    return NULL;
+}
+
+// EOF
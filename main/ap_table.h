@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////
+// AP table. Every BSSID seen by the scans, keyed by BSSID in a fixed
+// open addressing hash (linear probing, backward shift delete), no
+// heap. Scans update records in place. Entries not seen for max_age
+// seconds are removed, a full table gives up its stalest entry. Each
+// entry holds an id, fixed while it stays in the table, for views that
+// follow entries across snapshots. The channel stats follow every
+// present entry's channel and shown RSSI. (include esp_wifi.h and
+// ap_chan.h first)
+
+#define AP_TABLE_BITS       8
+#define AP_TABLE_SLOTS      (1 << AP_TABLE_BITS)
+#define AP_TABLE_MAX        (AP_TABLE_SLOTS * 3 / 4)    // Load limit
+
+#define AP_RSSI_AVG_SCALE   16          // rssi_avg, rssi_ewma fixed point
+#define AP_RSSI_AVG_SPAN    64          // Mean of the last ~64 sightings
+#define AP_RSSI_EWMA_SPAN   4           // Smoothing, alpha 1 / span
+#define AP_RSSI_HYST        3           // dB the smoothed value moves to show
+#define AP_RSSI_TREND       2           // dB between the two averages
+#define AP_HIST_LEN         16          // Samples kept per AP
+
+// RSSI history, struct of arrays indexed by entry id. A sample touches
+// one byte of the ring and its AP's head, count and extremes.
+
+typedef struct _ap_hist_t
+
+{
+    int8_t  ring[AP_TABLE_MAX][AP_HIST_LEN];
+    uint8_t head[AP_TABLE_MAX];         // Next sample goes here
+    uint8_t count[AP_TABLE_MAX];
+    int8_t  lo[AP_TABLE_MAX], hi[AP_TABLE_MAX];     // Over the ring
+
+} ap_hist_t;
+
+typedef struct _ap_entry_t
+
+{
+    uint32_t first_seen, last_seen;     // Seconds since boot
+    uint8_t  bssid[6];
+    uint8_t  primary, authmode;
+    int8_t   rssi, rssi_min, rssi_max;
+    uint8_t  missed;                    // Scans of its channel without it
+    uint8_t  id;                        // 0 .. AP_TABLE_MAX - 1, reused
+    int16_t  rssi_avg;                  // dBm * AP_RSSI_AVG_SCALE
+    uint16_t seen;                      // Sightings, 0: free slot
+    int16_t  rssi_ewma;                 // dBm * AP_RSSI_AVG_SCALE
+    int8_t   rssi_shown;                // Smoothed, moves AP_RSSI_HYST steps
+    int8_t   trend;                     // 1 rising, -1 falling, 0 steady
+    char     ssid[33];
+
+} ap_entry_t;
+
+typedef struct _ap_table_t
+
+{
+    int     count;
+    ap_entry_t slots[AP_TABLE_SLOTS];
+    uint8_t free_ids[AP_TABLE_MAX];     // Unused ids, AP_TABLE_MAX - count
+    ap_hist_t hist;
+    ap_chan_t chan;
+    uint8_t share_chan[AP_TABLE_MAX];   // What each id adds to chan,
+    int8_t  share_rssi[AP_TABLE_MAX];   // channel 0 for nothing
+    uint32_t added, gone, moved;        // Churn: present APs new, gone,
+                                        // changed channel or shown RSSI
+
+} ap_table_t;
+
+void ap_table_init(ap_table_t *tab);
+
+ap_entry_t *ap_table_find(ap_table_t *tab, const uint8_t *bssid);
+
+// Insert or refresh from a scan record. NULL only if it cannot be placed.
+
+ap_entry_t *ap_table_update(ap_table_t *tab, const wifi_ap_record_t *rec,
+                                uint32_t now);
+
+int  ap_table_remove(ap_table_t *tab, const uint8_t *bssid);
+
+// One channel scanned: APs on it get a miss, the records clear theirs
+
+int  ap_table_merge(ap_table_t *tab, int chan, const wifi_ap_record_t *recs,
+                                int cnt, uint32_t now);
+
+// Drop entries unseen for max_age seconds. Returns the number removed.
+
+int  ap_table_age(ap_table_t *tab, uint32_t now, uint32_t max_age);
+
+// Up to max recent RSSI samples of the entry, oldest first. Returns
+// the number copied.
+
+int  ap_table_hist(ap_table_t *tab, const ap_entry_t *ee, int8_t *out, int max);
+
+// Walk the entries, start with *pos = 0. NULL at the end.
+
+ap_entry_t *ap_table_next(ap_table_t *tab, int *pos);
+
+// EOF
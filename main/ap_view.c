@@ -0,0 +1,145 @@
+//////////////////////////////////////////////////////////////////////////
+// AP views, incremental sort and filter
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+#include "esp_wifi.h"
+
+#include "ap_chan.h"
+#include "ap_table.h"
+#include "wifi.h"
+#include "ap_view.h"
+
+// Negative if aa goes before bb. Ties go strongest first by the shown
+// RSSI, noise does not reorder, then by id so the order is total.
+
+static int  compare(int key, const ap_entry_t *aa, const ap_entry_t *bb)
+
+{
+    int diff = 0;
+
+    switch(key)
+        {
+        case AP_SORT_CHAN:  diff = aa->primary - bb->primary; break;
+        case AP_SORT_AUTH:  diff = aa->authmode - bb->authmode; break;
+        case AP_SORT_SSID:
+            // Hidden networks have no name, put them last
+            diff = (aa->ssid[0] == '\0') - (bb->ssid[0] == '\0');
+            if(diff == 0)
+                diff = strcmp(aa->ssid, bb->ssid);
+            break;
+        }
+    if(diff == 0)
+        diff = bb->rssi_shown - aa->rssi_shown;
+    if(diff == 0)
+        diff = aa->id - bb->id;
+    return diff;
+}
+
+static const ap_entry_t *entry(const ap_view_t *view, uint8_t id)
+
+{
+    return &view->snap->aps[view->index[id]];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ap_view_init(ap_view_t *view)
+
+{
+    memset(view, 0, sizeof(*view));
+    memset(view->index, AP_VIEW_NONE, sizeof(view->index));
+}
+
+int  ap_view_update(ap_view_t *view, const wifi_snap_t *snap)
+
+{
+    uint8_t kept[AP_TABLE_MAX];
+    int moved = 0, count = 0;
+
+    memset(view->index, AP_VIEW_NONE, sizeof(view->index));
+    for(int loop = 0; loop < snap->count; loop++)
+        view->index[snap->aps[loop].id] = loop;
+    view->snap = snap;
+
+    // Ids in the old orders that are still here. All orders hold the
+    // same ids, the first one tells.
+    memset(kept, false, sizeof(kept));
+    for(int loop = 0; loop < view->count; loop++)
+        {
+        uint8_t id = view->order[0][loop];
+        kept[id] = view->index[id] != AP_VIEW_NONE;
+        }
+
+    for(int key = 0; key < AP_SORT_KEYS; key++)
+        {
+        uint8_t *ord = view->order[key];
+
+        // Old order less the ones gone, the new ones at the end
+        count = 0;
+        for(int loop = 0; loop < view->count; loop++)
+            {
+            if(kept[ord[loop]])
+                ord[count++] = ord[loop];
+            }
+        for(int loop = 0; loop < snap->count; loop++)
+            {
+            if(!kept[snap->aps[loop].id])
+                ord[count++] = snap->aps[loop].id;
+            }
+
+        // Insertion, cheap on an order that is nearly right
+        for(int loop = 1; loop < count; loop++)
+            {
+            uint8_t id = ord[loop];
+            const ap_entry_t *ee = entry(view, id);
+            int pos = loop;
+            while(pos > 0 && compare(key, ee, entry(view, ord[pos - 1])) < 0)
+                {
+                ord[pos] = ord[pos - 1];
+                pos--;
+                }
+            if(pos != loop)
+                moved++;
+            ord[pos] = id;
+            }
+        }
+    view->count = count;
+    return moved;
+}
+
+int  ap_filter_match(const ap_filter_t *filt, const ap_entry_t *ee)
+
+{
+    if(filt == NULL)
+        return true;
+    if(filt->chan && ee->primary != filt->chan)
+        return false;
+    if(filt->auth >= 0 && ee->authmode != filt->auth)
+        return false;
+    if(filt->prefix && strncmp(ee->ssid, filt->prefix, strlen(filt->prefix)) != 0)
+        return false;
+    return true;
+}
+
+const ap_entry_t *ap_view_next(const ap_view_t *view, int key,
+                                const ap_filter_t *filt, int *pos)
+
+{
+    if(key < 0 || key >= AP_SORT_KEYS)
+        return NULL;
+    while(*pos < view->count)
+        {
+        const ap_entry_t *ee = entry(view, view->order[key][(*pos)++]);
+        if(ap_filter_match(filt, ee))
+            return ee;
+        }
+    return NULL;
+}
+
+// EOF
@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////
+// AP views. A sorted order of a scan snapshot for every key, all kept
+// up to date so switching views costs nothing. Orders hold AP ids, so
+// they carry over from one snapshot to the next: ids gone are dropped,
+// new ones appended, and the previous order is repaired by insertion.
+// RSSI moves little between sweeps, that is close to linear. Filters
+// are applied while walking an order, no records are copied.
+// (include ap_table.h and wifi.h first)
+
+enum {
+    AP_SORT_RSSI,                       // Strongest first
+    AP_SORT_CHAN,                       // Channel, then strongest
+    AP_SORT_AUTH,                       // Open first, then strongest
+    AP_SORT_SSID,                       // Name, hidden last
+    AP_SORT_KEYS
+    };
+
+#define AP_VIEW_NONE    0xff            // No entry for the id
+
+typedef struct _ap_filter_t
+
+{
+    int8_t   chan;                      // 0: any
+    int8_t   auth;                      // -1: any, else wifi_auth_mode_t
+    const char *prefix;                 // SSID prefix, NULL: any
+
+} ap_filter_t;
+
+typedef struct _ap_view_t
+
+{
+    const wifi_snap_t *snap;            // Last update, valid while held
+    int     count;
+    uint8_t order[AP_SORT_KEYS][AP_TABLE_MAX];  // Ids
+    uint8_t index[AP_TABLE_MAX];        // Id to snap->aps[] entry
+
+} ap_view_t;
+
+void ap_view_init(ap_view_t *view);
+
+// Carry the orders over to the snapshot. Returns the entries moved.
+
+int  ap_view_update(ap_view_t *view, const wifi_snap_t *snap);
+
+// Walk an order, start with *pos = 0. filt may be NULL. NULL at the end.
+
+const ap_entry_t *ap_view_next(const ap_view_t *view, int key,
+                                const ap_filter_t *filt, int *pos);
+
+int  ap_filter_match(const ap_filter_t *filt, const ap_entry_t *ee);
+
+// EOF
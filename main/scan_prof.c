@@ -0,0 +1,215 @@
+//////////////////////////////////////////////////////////////////////////
+// Scan profiles
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+#include "esp_log.h"
+#include "nvs_flash.h"
+
+#include "scan_prof.h"
+
+#ifndef CONFIG_WIFI_SCAN_DWELL_MS
+#define CONFIG_WIFI_SCAN_DWELL_MS       120
+#endif
+#ifndef CONFIG_WIFI_SCAN_CHANNELS
+#define CONFIG_WIFI_SCAN_CHANNELS       13
+#endif
+#ifndef CONFIG_WIFI_SCAN_PROFILE
+#define CONFIG_WIFI_SCAN_PROFILE        0
+#endif
+
+#ifdef CONFIG_WIFI_SCAN_PASSIVE
+#define CONFIG_PASSIVE  1
+#else
+#define CONFIG_PASSIVE  0
+#endif
+
+static const char *TAG = "ScanProf";
+
+static scan_prof_t profs[SCAN_PROFS] = {
+    { .name = "config",
+        .parm = { .chans = ((1 << (CONFIG_WIFI_SCAN_CHANNELS + 1)) - 2),
+                    .passive = CONFIG_PASSIVE, .hidden = 1,
+                    .active_min = CONFIG_WIFI_SCAN_DWELL_MS / 2,
+                    .active_max = CONFIG_WIFI_SCAN_DWELL_MS,
+                    .passive_ms = CONFIG_WIFI_SCAN_DWELL_MS } },
+    { .name = "fast",
+        .parm = { .chans = SCAN_PROF_ALL, .passive = 0, .hidden = 0,
+                    .active_min = 20, .active_max = 50, .passive_ms = 110 } },
+    { .name = "thorough",
+        .parm = { .chans = SCAN_PROF_ALL, .passive = 0, .hidden = 1,
+                    .active_min = 120, .active_max = 360, .passive_ms = 360 } },
+    { .name = "passive",
+        .parm = { .chans = SCAN_PROF_ALL, .passive = 1, .hidden = 1,
+                    .active_min = 120, .active_max = 360, .passive_ms = 360 } },
+    { .name = "single",
+        .parm = { .chans = SCAN_PROF_CHAN(6), .passive = 0, .hidden = 1,
+                    .active_min = 100, .active_max = 300, .passive_ms = 300 } },
+    };
+
+static volatile int curr = CONFIG_WIFI_SCAN_PROFILE;
+
+static int  parm_valid(const scan_parm_t *parm)
+
+{
+    if((parm->chans & ~((1 << 15) - 2)) || parm->chans == 0)
+        return false;
+    if(parm->active_min > parm->active_max || parm->active_max > SCAN_PROF_DWELL_MAX)
+        return false;
+    if(parm->passive_ms == 0 || parm->passive_ms > SCAN_PROF_DWELL_MAX)
+        return false;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void scan_prof_load()
+
+{
+    nvs_handle my_handle;
+    scan_parm_t parms[SCAN_PROFS];
+    esp_err_t err;
+
+    if(curr < 0 || curr >= SCAN_PROFS)
+        curr = SCAN_PROF_CONFIG;
+
+    err = nvs_open("storage", NVS_READWRITE, &my_handle);
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "Error (%d) opening NVS handle!", err);
+        return;
+        }
+    uint8_t sel = 0;
+    err = nvs_get_u8(my_handle, "scan_prof", &sel);
+    if (err == ESP_OK && sel < SCAN_PROFS)
+        curr = sel;
+
+    // Saved by another build with a different layout is ignored
+    size_t plen = sizeof(parms);
+    err = nvs_get_blob(my_handle, "scan_parms", parms, &plen);
+    if (err == ESP_OK && plen == sizeof(parms))
+        {
+        for(int loop = 0; loop < SCAN_PROFS; loop++)
+            {
+            if(parm_valid(&parms[loop]))
+                profs[loop].parm = parms[loop];
+            }
+        }
+    nvs_close(my_handle);
+
+    ESP_LOGI(TAG, "Scan profile '%s'", profs[curr].name);
+}
+
+int  scan_prof_save()
+
+{
+    nvs_handle my_handle;
+    scan_parm_t parms[SCAN_PROFS];
+    esp_err_t err, ret = 0;
+
+    for(int loop = 0; loop < SCAN_PROFS; loop++)
+        parms[loop] = profs[loop].parm;
+
+    err = nvs_open("storage", NVS_READWRITE, &my_handle);
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "Error (%d) opening NVS handle!", err);
+        return -1;
+        }
+    err = nvs_set_u8(my_handle, "scan_prof", curr);
+    if (err == ESP_OK)
+        err = nvs_set_blob(my_handle, "scan_parms", parms, sizeof(parms));
+    if (err == ESP_OK)
+        err = nvs_commit(my_handle);
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "Error (%d) writing scan profiles to NVS!", err);
+        ret = -1;
+        }
+    nvs_close(my_handle);
+
+    return ret;
+}
+
+int  scan_prof_curr()
+
+{
+    return curr;
+}
+
+scan_prof_t *scan_prof_get(int idx)
+
+{
+    if(idx < 0 || idx >= SCAN_PROFS)
+        return NULL;
+    return &profs[idx];
+}
+
+int  scan_prof_find(const char *name)
+
+{
+    for(int loop = 0; loop < SCAN_PROFS; loop++)
+        {
+        if(strcmp(profs[loop].name, name) == 0)
+            return loop;
+        }
+    return -1;
+}
+
+int  scan_prof_select(int idx)
+
+{
+    if(idx < 0 || idx >= SCAN_PROFS)
+        return -1;
+    if(idx == curr)
+        return 0;
+    curr = idx;
+    ESP_LOGI(TAG, "Scan profile '%s' from the next sweep", profs[curr].name);
+    return scan_prof_save();
+}
+
+int  scan_prof_set(int idx, const scan_parm_t *parm)
+
+{
+    if(idx < 0 || idx >= SCAN_PROFS || !parm_valid(parm))
+        return -1;
+    profs[idx].parm = *parm;
+    return scan_prof_save();
+}
+
+void scan_prof_sweep(int idx, uint32_t ms, int aps)
+
+{
+    scan_prof_t *pp = scan_prof_get(idx);
+
+    if(pp == NULL)
+        return;
+    if(pp->sweeps++ == 0)
+        pp->min_ms = pp->max_ms = ms;
+    pp->min_ms = ms < pp->min_ms ? ms : pp->min_ms;
+    pp->max_ms = ms > pp->max_ms ? ms : pp->max_ms;
+    pp->last_ms = ms;
+    pp->total_ms += ms;
+    pp->last_aps = aps;
+
+    ESP_LOGI(TAG, "Sweep '%s' %d ms (avg %d), %d APs", pp->name, ms,
+                                pp->total_ms / pp->sweeps, aps);
+}
+
+void scan_prof_report()
+
+{
+    printf("Profile    Sweeps  Last ms   Avg ms   Min ms   Max ms  APs\n");
+    for(int loop = 0; loop < SCAN_PROFS; loop++)
+        {
+        scan_prof_t *pp = &profs[loop];
+        printf("%c%-9s %6d %8d %8d %8d %8d %4d\n", loop == curr ? '*' : ' ',
+                    pp->name, pp->sweeps, pp->last_ms,
+                        pp->sweeps ? pp->total_ms / pp->sweeps : 0,
+                            pp->min_ms, pp->max_ms, pp->last_aps);
+        }
+}
+
+// EOF
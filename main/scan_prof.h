@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////////////
+// Scan profiles. A named set of sweep parameters: the channels, active
+// or passive, dwell times and hidden SSIDs. The scan task takes the
+// current profile at the start of every sweep, so a switch applies from
+// the next one. The choice and the parameters are kept in NVS. Every
+// sweep's duration and APs found go to its profile's stats, to weigh
+// sweep time against completeness on a site.
+
+#define SCAN_PROF_CONFIG    0           // From Kconfig
+#define SCAN_PROF_FAST      1
+#define SCAN_PROF_THOROUGH  2
+#define SCAN_PROF_PASSIVE   3
+#define SCAN_PROF_SINGLE    4           // One channel
+#define SCAN_PROFS          5
+
+#define SCAN_PROF_ALL       0x3ffe      // Channels 1 .. 13 ...
+#define SCAN_PROF_CHAN(nn)  (1 << (nn)) // ... bit n is channel n
+#define SCAN_PROF_DWELL_MAX 1500        // ms per channel, longest allowed
+
+// The part kept in NVS
+
+typedef struct _scan_parm_t
+
+{
+    uint16_t chans;                     // SCAN_PROF_CHAN() bits
+    uint8_t  passive;                   // No probe requests
+    uint8_t  hidden;                    // Report hidden SSIDs
+    uint16_t active_min, active_max;    // ms per channel
+    uint16_t passive_ms;                // ms per channel
+
+} scan_parm_t;
+
+typedef struct _scan_prof_t
+
+{
+    const char *name;
+    scan_parm_t parm;
+    uint32_t sweeps;
+    uint32_t last_ms, min_ms, max_ms;
+    uint32_t total_ms;                  // For the average
+    uint16_t last_aps;                  // Present after the last sweep
+
+} scan_prof_t;
+
+// Selection and parameters from NVS, defaults where none
+
+void scan_prof_load();
+int  scan_prof_save();
+
+int  scan_prof_curr();
+scan_prof_t *scan_prof_get(int idx);
+int  scan_prof_find(const char *name);
+
+// Select a profile, saved to NVS. Returns -1 for no such profile.
+
+int  scan_prof_select(int idx);
+
+// Change a profile's parameters, saved to NVS. Returns -1 if invalid.
+
+int  scan_prof_set(int idx, const scan_parm_t *parm);
+
+// A sweep with the profile took ms, aps present after it
+
+void scan_prof_sweep(int idx, uint32_t ms, int aps);
+
+// All profiles' stats to the console
+
+void scan_prof_report();
+
+// EOF
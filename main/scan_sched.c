@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////
+// Adaptive scan scheduling
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+
+#include "scan_sched.h"
+
+void scan_sched_init(scan_sched_t *sched, uint32_t min_ms, uint32_t max_ms,
+                            uint32_t threshold)
+
+{
+    memset(sched, 0, sizeof(*sched));
+    sched->min_ms = min_ms;
+    sched->max_ms = max_ms > min_ms ? max_ms : min_ms;
+    sched->threshold = threshold ? threshold : 1;
+    sched->idle_ms = min_ms;
+}
+
+uint32_t scan_sched_next(scan_sched_t *sched, uint32_t churn, uint32_t sweep_ms)
+
+{
+    sched->sweeps++;
+    sched->last_churn = churn;
+
+    if(churn >= sched->threshold)
+        sched->idle_ms = sched->min_ms;
+    else if(sched->idle_ms < sched->max_ms)
+        {
+        // Doubling from zero goes nowhere
+        uint32_t next = sched->idle_ms ? sched->idle_ms * 2 : sweep_ms;
+        sched->idle_ms = next < sched->max_ms ? next : sched->max_ms;
+        }
+
+    // Idle past the minimum, counted in whole sweeps at the minimum
+    uint32_t cycle = sweep_ms + sched->min_ms;
+    sched->saved_ms += sched->idle_ms - sched->min_ms;
+    if(cycle)
+        {
+        sched->saved += sched->saved_ms / cycle;
+        sched->saved_ms %= cycle;
+        }
+    sched->radio_ms += sweep_ms;
+    sched->total_ms += sweep_ms + sched->idle_ms;
+
+    return sched->idle_ms;
+}
+
+int  scan_sched_duty(const scan_sched_t *sched)
+
+{
+    if(sched->total_ms == 0)
+        return 100;
+    return (int)(sched->radio_ms * 100 / sched->total_ms);
+}
+
+// EOF
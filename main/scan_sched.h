@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////////////////////////
+// Adaptive scan scheduling. After each sweep the churn, APs come, gone
+// or moved by a shown RSSI step, sets the idle time before the next
+// one. Churn at or over the threshold goes back to the minimum, a quiet
+// sweep doubles the idle time up to the maximum. Sweeps saved against
+// running at the minimum all the time, and the radio's share of the
+// time, are counted.
+
+typedef struct _scan_sched_t
+
+{
+    uint32_t min_ms, max_ms;            // Idle between sweeps
+    uint32_t threshold;                 // Churn that counts as change
+    uint32_t idle_ms;                   // Current
+    uint32_t last_churn;
+    uint32_t sweeps, saved;             // Done, and skipped
+    uint32_t saved_ms;                  // Toward the next saved sweep
+    uint64_t radio_ms, total_ms;        // Sweeping, sweeping and idle
+
+} scan_sched_t;
+
+void scan_sched_init(scan_sched_t *sched, uint32_t min_ms, uint32_t max_ms,
+                            uint32_t threshold);
+
+// A sweep took sweep_ms and saw churn changes. Returns ms to idle.
+
+uint32_t scan_sched_next(scan_sched_t *sched, uint32_t churn, uint32_t sweep_ms);
+
+// Percent of the time spent sweeping
+
+int  scan_sched_duty(const scan_sched_t *sched);
+
+// EOF
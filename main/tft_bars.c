@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////
+// Bar charts, changed rows only
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_blend.h"
+#include "tft_bars.h"
+
+static int  bar_height(const tft_bars_t *bars, int value)
+
+{
+    if(bars->hi <= bars->lo)
+        return 0;
+    value = MIN(MAX(value, bars->lo), bars->hi);
+    return (value - bars->lo) * bars->hh / (bars->hi - bars->lo);
+}
+
+// Rows from .. to of a bar, counted from the top, into screen memory
+
+static void fill_rows(const tft_bars_t *bars, int xx, int from, int to,
+                            int height, uint16_t color)
+
+{
+    for(int loop = from; loop < to; loop++)
+        {
+        int yy = bars->yy + loop;
+        if(yy < 0 || yy >= SCREEN_HEIGHT)
+            continue;
+        tft_span_fill(TFT_FB_ROW(yy) + xx, bars->bar_ww,
+                    loop >= bars->hh - height ? color : bars->back);
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void tft_bars_init(tft_bars_t *bars, int xx, int yy, int pitch, int bar_ww,
+                        int hh, int count, int lo, int hi, uint16_t back)
+
+{
+    memset(bars, 0, sizeof(*bars));
+    bars->xx = xx; bars->yy = yy; bars->hh = hh;
+    bars->pitch = pitch;
+    bars->bar_ww = MIN(bar_ww, pitch);
+    bars->count = MIN(MAX(count, 0), TFT_BARS_MAX);
+    bars->lo = lo; bars->hi = hi;
+    bars->back = back;
+    tft_bars_invalidate(bars);
+}
+
+void tft_bars_invalidate(tft_bars_t *bars)
+
+{
+    for(int loop = 0; loop < TFT_BARS_MAX; loop++)
+        bars->shown[loop] = -1;
+}
+
+int  tft_bars_set(spi_device_handle_t spi, tft_bars_t *bars, int idx,
+                        int value, uint16_t color)
+
+{
+    int from, to, height = bar_height(bars, value);
+    int xx = bars->xx + idx * bars->pitch;
+
+    if(idx < 0 || idx >= bars->count)
+        return 0;
+    if(xx < 0 || xx + bars->bar_ww > SCREEN_WIDTH)
+        return 0;
+
+    int old = bars->shown[idx];
+    if(old < 0 || bars->colors[idx] != color)
+        {
+        // Unknown or recolored, the whole bar
+        from = 0; to = bars->hh;
+        }
+    else
+        {
+        from = bars->hh - MAX(old, height);
+        to = bars->hh - MIN(old, height);
+        }
+    bars->shown[idx] = height;
+    bars->colors[idx] = color;
+    if(from >= to)
+        return 0;
+
+    fill_rows(bars, xx, from, to, height, color);
+    tft_flush_rect(spi, xx, bars->yy + from, bars->bar_ww, to - from);
+    return bars->bar_ww * (to - from);
+}
+
+int  tft_bars_clear(spi_device_handle_t spi, tft_bars_t *bars)
+
+{
+    int ww = bars->pitch * bars->count;
+    int xx = MAX(bars->xx, 0);
+
+    ww = MIN(bars->xx + ww, SCREEN_WIDTH) - xx;
+    tft_bars_invalidate(bars);
+    if(ww <= 0)
+        return 0;
+
+    for(int loop = 0; loop < bars->hh; loop++)
+        {
+        int yy = bars->yy + loop;
+        if(yy >= 0 && yy < SCREEN_HEIGHT)
+            tft_span_fill(TFT_FB_ROW(yy) + xx, ww, bars->back);
+        }
+    tft_flush_rect(spi, xx, bars->yy, ww, bars->hh);
+    return ww * bars->hh;
+}
+
+// EOF
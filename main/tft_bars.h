@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////////////////////////
+// Bar charts. A row of vertical bars growing up from the bottom of a
+// box, values mapped from lo .. hi to 0 .. hh pixels. Every bar keeps
+// the height and color it drew. Setting a value fills and sends only
+// the rows between the old and the new top, an unchanged bar costs
+// nothing. Two charts with the same pitch and shifted x interleave.
+// (include tft_base.h first)
+
+#define TFT_BARS_MAX    16
+
+typedef struct _tft_bars_t
+
+{
+    int16_t xx, yy, hh;                 // Box, the first bar's left
+    int16_t pitch, bar_ww, count;
+    int32_t lo, hi;                     // Values for empty and full
+    uint16_t back;
+    int16_t shown[TFT_BARS_MAX];        // Height on screen, -1: unknown
+    uint16_t colors[TFT_BARS_MAX];
+
+} tft_bars_t;
+
+void tft_bars_init(tft_bars_t *bars, int xx, int yy, int pitch, int bar_ww,
+                        int hh, int count, int lo, int hi, uint16_t back);
+
+// Show the value on bar idx. Returns the number of pixels sent.
+
+int  tft_bars_set(spi_device_handle_t spi, tft_bars_t *bars, int idx,
+                        int value, uint16_t color);
+
+// Box to background. Next set draws whole bars.
+
+int  tft_bars_clear(spi_device_handle_t spi, tft_bars_t *bars);
+void tft_bars_invalidate(tft_bars_t *bars);
+
+// EOF
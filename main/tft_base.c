@@ -48,6 +48,11 @@ static int verbose = 0;
 uint16_t (*pscreen)[SCREEN_HEIGHT/2][SCREEN_WIDTH] = NULL;
 uint16_t (*pscreen2)[SCREEN_HEIGHT/2][SCREEN_WIDTH] = NULL;
 
+// Rectangles narrower than the screen are not contiguous in the screen
+// memory, they get packed here and go out as one transaction
+
+static uint16_t *pstage = NULL;
+
 // Call this at the beginning ... alloc big buffer
 // If no TFT / LCD present need not call it
 
@@ -70,6 +75,8 @@ void    lcd_pre_init()
         vTaskDelay(2000 / portTICK_RATE_MS);
         esp_restart();
         }    
+    // Not fatal, tft_flush_rect falls back to line by line
+    pstage = heap_caps_malloc(TFT_STAGE_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);   
     //printf("free heap %d try %d\n", esp_get_free_heap_size(), memlen/2);
 }
 
@@ -150,7 +157,8 @@ spi_bus_config_t buscfg={
         .mosi_io_num=PIN_NUM_MOSI,
         .sclk_io_num=PIN_NUM_CLK,
         .quadwp_io_num=-1,
-        .quadhd_io_num=-1
+        .quadhd_io_num=-1,
+        .max_transfer_sz=TFT_STAGE_PIXELS * sizeof(uint16_t),
     };
     
 // The SPI can do 40 MHz
@@ -436,15 +444,15 @@ int  send_screen_block(tft_range *parm)
     
     trans[1].tx_data[0]=HIBYTE(parm->xpos);             // Start Col High
     trans[1].tx_data[1]=LOBYTE(parm->xpos);             // Start Col Low
-    trans[1].tx_data[2]=HIBYTE(parm->xpos+parm->www);   // End Col High
-    trans[1].tx_data[3]=LOBYTE(parm->xpos+parm->www);   // End Col Low
+    trans[1].tx_data[2]=HIBYTE(parm->xpos+parm->www-1); // End Col High
+    trans[1].tx_data[3]=LOBYTE(parm->xpos+parm->www-1); // End Col Low
     
     trans[2].tx_data[0]=0x2B;               // Page address set
     
     trans[3].tx_data[0]=HIBYTE(parm->ypos);            // Start page high
     trans[3].tx_data[1]=LOBYTE(parm->ypos);           // start page low
-    trans[3].tx_data[2]=HIBYTE(parm->ypos+parm->hhh);  // end page high
-    trans[3].tx_data[3]=LOBYTE(parm->ypos+parm->hhh); // end page low
+    trans[3].tx_data[2]=HIBYTE(parm->ypos+parm->hhh-1); // end page high
+    trans[3].tx_data[3]=LOBYTE(parm->ypos+parm->hhh-1); // end page low
     
     trans[4].tx_data[0]=0x2C;               // Memory write
     
@@ -474,6 +482,67 @@ int  send_block(tft_range *parm)
     return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Send a rectangle of the screen memory to the LCD. Full width bands are 
+// contiguous, they go straight from screen memory. Narrower ones are 
+// packed into the staging buffer. Either way one transaction per 
+// TFT_STAGE_PIXELS, instead of one per line.
+
+int  tft_flush_rect(spi_device_handle_t spi, int xx, int yy, int ww, int hh)
+
+{
+    int ret = 0; tft_range parm;
+    
+    // Clip to screen
+    if(xx < 0) { ww += xx; xx = 0; }
+    if(yy < 0) { hh += yy; yy = 0; }
+    if(xx + ww > SCREEN_WIDTH)  ww = SCREEN_WIDTH - xx;
+    if(yy + hh > SCREEN_HEIGHT) hh = SCREEN_HEIGHT - yy;
+    
+    if(ww <= 0 || hh <= 0)
+        return -1;
+        
+    parm.spi = spi; parm.xpos = xx; parm.www = ww;
+    
+    int rows = TFT_STAGE_PIXELS / ww;
+    if(pstage == NULL && ww != SCREEN_WIDTH)
+        rows = 1;
+        
+    for(int loop = yy; loop < yy + hh; loop += parm.hhh)
+        {
+        parm.ypos = loop; 
+        parm.hhh = MIN(rows, yy + hh - loop);
+        
+        if(ww == SCREEN_WIDTH)
+            {
+            // Do not cross over to the other half 
+            if(loop < SCREEN_HEIGHT / 2)
+                parm.hhh = MIN(parm.hhh, SCREEN_HEIGHT / 2 - loop);
+            parm.line = TFT_FB_ROW(loop);
+            }
+        else if(parm.hhh == 1)
+            {
+            parm.line = TFT_FB_ROW(loop) + xx;
+            }
+        else
+            {
+            uint16_t *dst = pstage;
+            for(int loop2 = 0; loop2 < parm.hhh; loop2++)
+                {
+                memcpy(dst, TFT_FB_ROW(loop + loop2) + xx, ww * sizeof(uint16_t));
+                dst += ww;
+                }
+            parm.line = pstage;
+            }
+        ret = send_screen_block(&parm);
+        if(ret < 0)
+            break;
+        // The stage is reused for the next chunk, wait for it
+        is_transfer_finished(spi); 
+        }
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////
 // This was the original routine from sample
 
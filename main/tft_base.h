@@ -40,6 +40,11 @@ typedef struct _tft_frame_t
 #define HIBYTE(xx) (((xx)>>8))
 #define LOBYTE(xx) (((xx)&0xff))
 
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
 // Allocate big block before anyone gets a chance
 // This is required so the rest of the system does not frag the memory 
 // beyond (below the amount of) buffer we need
@@ -61,12 +66,29 @@ typedef struct _tft_frame_t
 extern uint16_t (*pscreen)[SCREEN_HEIGHT/2][SCREEN_WIDTH];
 extern uint16_t (*pscreen2)[SCREEN_HEIGHT/2][SCREEN_WIDTH];
 
+// Row pointer into the screen memory, hides the two half split
+
+#define TFT_FB_ROW(yy)                                          \
+    ((yy) < SCREEN_HEIGHT / 2 ? (*pscreen)[(yy)] :              \
+                    (*pscreen2)[(yy) - SCREEN_HEIGHT / 2])      \
+
+// Pixels are kept in the order they go out on the wire. (byte swapped
+// relative to the CPU) Anything doing per channel math has to swap.
+
+#define TFT_SWAP16(cc) ((uint16_t)(((cc) << 8) | (((cc) >> 8) & 0xff)))
+
+// DMA staging area for sending rectangles in one transaction
+
+#define TFT_STAGE_ROWS      16
+#define TFT_STAGE_PIXELS    (SCREEN_WIDTH * TFT_STAGE_ROWS)
+
 void    lcd_pre_init();
 int  init_spi(spi_device_handle_t *pspi);
 int  lcd_init(spi_device_handle_t spi);
 void send_line(spi_device_handle_t spi, int ypos, uint16_t *line);
 int  send_screen(tft_range *parm);
 int  send_block(tft_range *parm);
+int  tft_flush_rect(spi_device_handle_t spi, int xx, int yy, int ww, int hh);
 
 void is_transfer_finished(spi_device_handle_t spi);
 void clear_screen(spi_device_handle_t spi, uint16_t color);
@@ -87,10 +109,42 @@ extern int  fontback;       // BG color for font
 
 int draw_char(spi_device_handle_t, uint8_t chh, int size, int xx, int yy, uint16_t color);
 int draw_str(spi_device_handle_t spi, uint8_t *sss, int size, int xx, int yy, uint16_t color);
+int draw_str_render(uint8_t *sss, int size, int xx, int yy, uint16_t color, int *hhh);
 
 int draw_char_extent(uint8_t chh, int size, int *www, int *hhh);
+int draw_char_render(uint8_t chh, int size, uint16_t *dst, int stride, 
+                            uint16_t color, uint16_t back);
 int draw_str_extent(uint8_t *sss, int size, int *www, int *hhh);
 
+// Same, with a font descriptor from tft_fonts.h. Resolve it once 
+// (tft_font_get) and keep it, the size calls above map to these.
+// Strings are UTF-8, glyphs missing from the font come from its 
+// fallback chain, Latin-1 letters fold to ASCII as the last resort.
+
+struct _tft_font_t;
+
+int draw_text(spi_device_handle_t spi, const struct _tft_font_t *font, uint8_t *sss, 
+                            int xx, int yy, uint16_t color);
+int draw_text_render(const struct _tft_font_t *font, uint8_t *sss, int xx, int yy, 
+                            uint16_t color, int *hhh);
+int draw_text_extent(const struct _tft_font_t *font, uint8_t *sss, int *www, int *hhh);
+
+int font_char_extent(const struct _tft_font_t *font, uint32_t code, int *www, int *hhh);
+int font_char_render(const struct _tft_font_t *font, uint32_t code, uint16_t *dst, 
+                            int stride, uint16_t color, uint16_t back);
+
+// By glyph index, after the lookup. (glyph cache, layout)
+
+const struct _tft_font_t *font_glyph_find(const struct _tft_font_t *font, 
+                            uint32_t code, int *idx);
+int font_glyph_draw(const struct _tft_font_t *font, int idx, int xx, int yy, 
+                            uint16_t color, uint16_t back);
+int font_glyph_extent(const struct _tft_font_t *font, int idx, int *www, int *hhh);
+int font_glyph_render(const struct _tft_font_t *font, int idx, uint16_t *dst, 
+                            int stride, uint16_t color, uint16_t back);
+
+uint32_t tft_utf8_next(const uint8_t **sss);
+
 // EOF
 
 
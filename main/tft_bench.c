@@ -0,0 +1,225 @@
+//////////////////////////////////////////////////////////////////////////
+// TFT benchmarks
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_gcache.h"
+#include "tft_layout.h"
+#include "tft_label.h"
+#include "tft_num.h"
+#include "tft_bars.h"
+#include "tft_bench.h"
+
+#define BENCH_LOOPS 50
+
+static const char *bench_lines[] = {
+    "01 HomeNetwork-5G          ",
+    "02 guest                   ",
+    "ch6  -67dB WPA2",
+    "ch11 -81dB OPEN",
+    };
+
+#define BENCH_NLINES (sizeof(bench_lines) / sizeof(bench_lines[0]))
+
+// 40 characters, size 16
+static const char *bench_str40 = "Scanning (42) ... 11 APs, ch 1-13 active";
+
+// Time draw_str over the sample lines, return usec per string
+
+static int  bench_draw_str(spi_device_handle_t spi, int size)
+
+{
+    int64_t start = esp_timer_get_time();
+
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        {
+        for(int loop2 = 0; loop2 < BENCH_NLINES; loop2++)
+            draw_str(spi, (uint8_t *)bench_lines[loop2], size, 4, 34 + 18 * loop2, TFT_WHITE);
+        }
+    return (int)((esp_timer_get_time() - start) / (BENCH_LOOPS * BENCH_NLINES));
+}
+
+// The way draw_str used to send its text box, one blocking line at a time
+
+static void flush_by_line(spi_device_handle_t spi, int xx, int yy, int ww, int hh)
+
+{
+    tft_range parm;
+
+    parm.spi = spi; parm.hhh = 1;
+    parm.xpos = xx; parm.www = ww;
+    for(int loop = 0; loop < hh; loop++)
+        {
+        parm.ypos = yy + loop;
+        parm.line = TFT_FB_ROW(yy + loop) + xx;
+        send_block(&parm);
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Time per string for a 40 character size 16 string: render only,
+// render + line by line send (old draw_str), render + one region send
+
+static void bench_str40_run(spi_device_handle_t spi)
+
+{
+    int64_t start; int pos = 0, hh = 0, render, by_line, region;
+
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        pos = draw_str_render((uint8_t *)bench_str40, 16, 1, 200, TFT_WHITE, &hh);
+    render = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        {
+        pos = draw_str_render((uint8_t *)bench_str40, 16, 1, 200, TFT_WHITE, &hh);
+        flush_by_line(spi, 1, 200, pos - 1, hh);
+        }
+    by_line = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        draw_str(spi, (uint8_t *)bench_str40, 16, 1, 200, TFT_WHITE);
+    region = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    printf("Bench 40 chars size 16 (%d x %d px): render %d us, "
+                "by line %d us/str, one region %d us/str\n",
+                            pos - 1, hh, render, by_line, region);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// draw_str throughput, glyph cache on and off
+
+void tft_bench_text(spi_device_handle_t spi)
+
+{
+    int saved = gcache_enabled, sizes[] = { 16, 32 };
+
+    for(int loop = 0; loop < sizeof(sizes) / sizeof(sizes[0]); loop++)
+        {
+        gcache_enabled = false;
+        int off = bench_draw_str(spi, sizes[loop]);
+
+        gcache_enabled = true;
+        tft_gcache_clear(); tft_gcache_reset_stats();
+        int on = bench_draw_str(spi, sizes[loop]);
+
+        printf("Bench draw_str size %d: cache off %d us/str, cache on %d us/str\n",
+                                                    sizes[loop], off, on);
+        tft_gcache_print_stats();
+        }
+    for(int loop = 0; loop < 2; loop++)
+        {
+        gcache_enabled = loop;
+        bench_str40_run(spi);
+        }
+    gcache_enabled = saved;
+    clear_screen(spi, TFT_BLACK);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// AP row info field on a rescan where only the RSSI moves: whole 
+// field redraw against the label cell diff
+
+void tft_bench_label(spi_device_handle_t spi)
+
+{
+    static tft_label_t lab;
+    static const char *rssi[] = { "ch6  -67dB WPA2", "ch6  -68dB WPA2" };
+    const tft_font_t *font = tft_font_get(TFT_FONT_16);
+    int64_t start; int field, label, sent = 0;
+
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        tft_text_field(spi, font, (uint8_t *)rssi[loop & 1], 205, 34, 
+                                SCREEN_WIDTH - 207, TFT_ALIGN_LEFT, TFT_WHITE);
+    field = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    tft_label_init(&lab, font, 205, 34, SCREEN_WIDTH - 207, TFT_ALIGN_LEFT, 
+                                                        TFT_WHITE, fontback);
+    tft_label_set(spi, &lab, (uint8_t *)rssi[1]);
+    
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        sent += tft_label_set(spi, &lab, (uint8_t *)rssi[loop & 1]);
+    label = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    printf("Bench label RSSI update: field %d px %d us, label %d px %d us\n",
+                (SCREEN_WIDTH - 207) * font->height * font->scale, field, 
+                                            sent / BENCH_LOOPS, label);
+    clear_screen(spi, TFT_BLACK);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RSSI value moving by one: snprintf and a label against the numeric 
+// field
+
+void tft_bench_num(spi_device_handle_t spi)
+
+{
+    static tft_label_t lab;
+    static tft_num_t num;
+    char buf[16];
+    const tft_font_t *font = tft_font_get(TFT_FONT_16);
+    int64_t start; int label, field, lsent = 0, nsent = 0;
+
+    tft_label_init(&lab, font, 240, 34, 40, TFT_ALIGN_LEFT, TFT_WHITE, fontback);
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        {
+        snprintf(buf, sizeof(buf), "%3ddB", -67 - (loop & 1));
+        lsent += tft_label_set(spi, &lab, (uint8_t *)buf);
+        }
+    label = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    tft_num_init(&num, font, 240, 54, 3, NULL, "dB", TFT_WHITE, fontback);
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        nsent += tft_num_set(spi, &num, -67 - (loop & 1));
+    field = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    printf("Bench num RSSI update: label %d px %d us, num %d px %d us\n",
+                lsent / BENCH_LOOPS, label, nsent / BENCH_LOOPS, field);
+    clear_screen(spi, TFT_BLACK);
+}
+
+// A channel chart bar moving by a few dB, against redrawing it whole
+
+void tft_bench_bars(spi_device_handle_t spi)
+
+{
+    static tft_bars_t bars;
+    int64_t start; int whole, delta, wsent = 0, dsent = 0;
+
+    tft_bars_init(&bars, 20, 34, 22, 7, 140, 14, -100, -20, fontback);
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        {
+        tft_bars_invalidate(&bars);
+        wsent += tft_bars_set(spi, &bars, loop % 14, -60 - (loop & 3), TFT_GREEN);
+        }
+    whole = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    start = esp_timer_get_time();
+    for(int loop = 0; loop < BENCH_LOOPS; loop++)
+        dsent += tft_bars_set(spi, &bars, loop % 14, -60 - (loop & 3), TFT_GREEN);
+    delta = (int)((esp_timer_get_time() - start) / BENCH_LOOPS);
+
+    printf("Bench bars update: whole %d px %d us, changed rows %d px %d us\n",
+                wsent / BENCH_LOOPS, whole, dsent / BENCH_LOOPS, delta);
+    clear_screen(spi, TFT_BLACK);
+}
+
+// EOF
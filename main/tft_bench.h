@@ -0,0 +1,10 @@
+//////////////////////////////////////////////////////////////////////////
+// TFT benchmarks. Enabled with CONFIG_TFT_BENCH, results go to the
+// console. They draw over the screen, call before the real content.
+
+void tft_bench_text(spi_device_handle_t spi);
+void tft_bench_label(spi_device_handle_t spi);
+void tft_bench_num(spi_device_handle_t spi);
+void tft_bench_bars(spi_device_handle_t spi);
+
+// EOF
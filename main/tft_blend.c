@@ -0,0 +1,267 @@
+//////////////////////////////////////////////////////////////////////////
+// Alpha blending, span kernels and anti aliased shapes
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_blend.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Blend one pixel, fg over bg
+
+uint16_t tft_blend(uint16_t fg, uint16_t bg, uint8_t alpha)
+
+{
+    uint32_t aa = TFT_ALPHA32(alpha);
+    uint32_t fx = TFT_BLEND_SPREAD(fg), bx = TFT_BLEND_SPREAD(bg);
+
+    uint32_t xx = (fx * aa + bx * (32 - aa)) >> 5;
+    return TFT_BLEND_FOLD(xx);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Blend tables, replaced round robin
+
+typedef struct _blend_lut
+
+{
+    uint32_t colors;            // fg << 16 | bg
+    int      levels;            // 0: unused
+    uint16_t lut[TFT_BLEND_LUT_MAX];
+
+} blend_lut;
+
+static blend_lut luts[TFT_BLEND_LUTS];
+static int  lut_next = 0, lut_last = 0;
+
+const uint16_t *tft_blend_lut(uint16_t fg, uint16_t bg, int levels)
+
+{
+    uint32_t colors = ((uint32_t)fg << 16) | bg;
+    
+    if(levels < 2 || levels > TFT_BLEND_LUT_MAX)
+        return NULL;
+        
+    // Same pair as last time is the common case (a string)
+    if(luts[lut_last].colors == colors && luts[lut_last].levels == levels)
+        return luts[lut_last].lut;
+        
+    for(int loop = 0; loop < TFT_BLEND_LUTS; loop++)
+        {
+        if(luts[loop].colors == colors && luts[loop].levels == levels)
+            {
+            lut_last = loop;
+            return luts[loop].lut;
+            }
+        }
+    blend_lut *bl = &luts[lut_next];
+    lut_last = lut_next;
+    lut_next = (lut_next + 1) % TFT_BLEND_LUTS;
+    
+    bl->colors = colors; bl->levels = levels;
+    for(int loop = 0; loop < levels; loop++)
+        bl->lut[loop] = tft_blend(fg, bg, (loop * 255) / (levels - 1));
+        
+    return bl->lut;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Solid fill, two pixels per store once the pointer is aligned
+
+void tft_span_fill(uint16_t *dst, int cnt, uint16_t color)
+
+{
+    if(cnt <= 0)
+        return;
+
+    if((uintptr_t)dst & 2)
+        {
+        *dst++ = color; cnt--;
+        }
+    uint32_t *dst2 = (uint32_t *)dst;
+    uint32_t color2 = color | ((uint32_t)color << 16);
+
+    for(int loop = cnt >> 1; loop > 0; loop--)
+        *dst2++ = color2;
+
+    if(cnt & 1)
+        *(uint16_t *)dst2 = color;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Constant alpha over a span. The color side of the product is
+// pre calculated, leaving one multiply per pixel.
+
+void tft_span_blend(uint16_t *dst, int cnt, uint16_t color, uint8_t alpha)
+
+{
+    uint32_t aa = TFT_ALPHA32(alpha);
+
+    if(aa == 0)
+        return;
+    if(aa >= 32)
+        {
+        tft_span_fill(dst, cnt, color);
+        return;
+        }
+    uint32_t fxa = TFT_BLEND_SPREAD(color) * aa, ia = 32 - aa;
+
+    for(int loop = 0; loop < cnt; loop++)
+        {
+        uint32_t bx = TFT_BLEND_SPREAD(dst[loop]);
+        uint32_t xx = (fxa + bx * ia) >> 5;
+        dst[loop] = TFT_BLEND_FOLD(xx);
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Per pixel alpha from an 8 bit mask (coverage, glyph, icon)
+
+void tft_span_blend_mask(uint16_t *dst, const uint8_t *mask, int cnt, uint16_t color)
+
+{
+    uint32_t fx = TFT_BLEND_SPREAD(color);
+
+    for(int loop = 0; loop < cnt; loop++)
+        {
+        uint32_t aa = TFT_ALPHA32(mask[loop]);
+
+        // Most of a mask is empty or solid
+        if(aa == 0)
+            continue;
+        if(aa >= 32)
+            {
+            dst[loop] = color;
+            continue;
+            }
+        uint32_t bx = TFT_BLEND_SPREAD(dst[loop]);
+        uint32_t xx = (fx * aa + bx * (32 - aa)) >> 5;
+        dst[loop] = TFT_BLEND_FOLD(xx);
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Translucent rectangle
+
+int tft_rect_alpha(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        uint16_t color, uint8_t alpha)
+
+{
+    if(xx < 0) { ww += xx; xx = 0; }
+    if(yy < 0) { hh += yy; yy = 0; }
+    if(xx + ww > SCREEN_WIDTH)  ww = SCREEN_WIDTH - xx;
+    if(yy + hh > SCREEN_HEIGHT) hh = SCREEN_HEIGHT - yy;
+
+    if(ww <= 0 || hh <= 0)
+        return -1;
+
+    for(int loop = yy; loop < yy + hh; loop++)
+        tft_span_blend(TFT_FB_ROW(loop) + xx, ww, color, alpha);
+
+    if(spi)
+        return tft_flush_rect(spi, xx, yy, ww, hh);
+    return 0;
+}
+
+static void blend_pixel(int xx, int yy, uint16_t color, uint32_t alpha)
+
+{
+    if(xx < 0 || yy < 0 || xx >= SCREEN_WIDTH || yy >= SCREEN_HEIGHT)
+        return;
+
+    uint16_t *ptr = TFT_FB_ROW(yy) + xx;
+    *ptr = tft_blend(color, *ptr, alpha);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Anti aliased line. (Xiaolin Wu) Walks the major axis, the minor
+// axis is carried in 16.16 fixed point; the fraction splits the
+// coverage between the two pixels straddling the ideal line.
+
+int tft_line_aa(spi_device_handle_t spi, int xx, int yy, int xx2, int yy2,
+                        uint16_t color)
+
+{
+    int steep = abs(yy2 - yy) > abs(xx2 - xx);
+
+    if(steep)
+        {
+        int tmp = xx; xx = yy; yy = tmp;
+        tmp = xx2; xx2 = yy2; yy2 = tmp;
+        }
+    if(xx2 < xx)
+        {
+        // Swap
+        int tmp = xx2; xx2 = xx; xx = tmp;
+        tmp = yy2; yy2 = yy; yy = tmp;
+        }
+    int dx = xx2 - xx, dy = yy2 - yy;
+    int grad = dx ? (dy << 16) / dx : 0;
+    int inter = (yy << 16) + 0x8000;
+
+    for(int loop = xx; loop <= xx2; loop++)
+        {
+        int whole = (inter - 0x8000) >> 16;
+        uint32_t frac = ((inter - 0x8000) >> 8) & 0xff;
+
+        if(steep)
+            {
+            blend_pixel(whole,     loop, color, 255 - frac);
+            blend_pixel(whole + 1, loop, color, frac);
+            }
+        else
+            {
+            blend_pixel(loop, whole,     color, 255 - frac);
+            blend_pixel(loop, whole + 1, color, frac);
+            }
+        inter += grad;
+        }
+
+    if(spi)
+        {
+        // Bounding box of the drawn pixels, back in screen orientation
+        int lo = MIN(yy, yy2), hi = MAX(yy, yy2) + 2;
+        if(steep)
+            return tft_flush_rect(spi, lo, xx, hi - lo, xx2 - xx + 1);
+        else
+            return tft_flush_rect(spi, xx, lo, xx2 - xx + 1, hi - lo);
+        }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Paint color through an 8 bit alpha mask. (stride in bytes)
+
+int tft_blit_alpha(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        const uint8_t *mask, int stride, uint16_t color)
+
+{
+    int mx = 0, my = 0;
+
+    if(xx < 0) { ww += xx; mx = -xx; xx = 0; }
+    if(yy < 0) { hh += yy; my = -yy; yy = 0; }
+    if(xx + ww > SCREEN_WIDTH)  ww = SCREEN_WIDTH - xx;
+    if(yy + hh > SCREEN_HEIGHT) hh = SCREEN_HEIGHT - yy;
+
+    if(ww <= 0 || hh <= 0)
+        return -1;
+
+    for(int loop = 0; loop < hh; loop++)
+        {
+        tft_span_blend_mask(TFT_FB_ROW(yy + loop) + xx,
+                    mask + (my + loop) * stride + mx, ww, color);
+        }
+    if(spi)
+        return tft_flush_rect(spi, xx, yy, ww, hh);
+    return 0;
+}
+
+// EOF
@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////
+// Alpha blending and anti aliased drawing.
+//
+// Blending works on the packed 565 pixel: spread it to 0x07E0F81F
+// (green moves to the upper half) so all three channels scale with
+// a single multiply, then fold it back. Alpha is 0-255 on the API,
+// kept as 0-32 internally.
+//
+// The span kernels do a whole run per call, the shape routines are
+// built on them. Pass spi as NULL to compose into the screen memory
+// only, then send it with tft_flush_rect() when done.
+
+#define TFT_ALPHA_OPAQUE        255
+#define TFT_ALPHA_TRANSPARENT   0
+
+#define TFT_BLEND_MASK  0x07E0F81FUL
+
+// Spread / fold a (wire order) pixel to / from the blend format
+
+#define TFT_BLEND_SPREAD(cc)                                        \
+    ((((uint32_t)TFT_SWAP16(cc)) | ((uint32_t)TFT_SWAP16(cc) << 16)) \
+                                                & TFT_BLEND_MASK)   \
+
+#define TFT_BLEND_FOLD(xx)                                          \
+    TFT_SWAP16((uint16_t)(((xx) & TFT_BLEND_MASK) |                 \
+                        (((xx) & TFT_BLEND_MASK) >> 16)))           \
+
+// 8 bit alpha to 0-32 blend weight, 255 maps to 32
+
+#define TFT_ALPHA32(aa)     (((uint32_t)(aa) + 4) >> 3)
+
+uint16_t tft_blend(uint16_t fg, uint16_t bg, uint8_t alpha);
+
+// Blend table for a color pair: levels entries from bg (0) to fg 
+// (levels - 1). Built once per pair, the last TFT_BLEND_LUTS pairs 
+// are kept. For anti aliased glyphs, a lookup per pixel, no multiply.
+
+#define TFT_BLEND_LUTS      4
+#define TFT_BLEND_LUT_MAX   16
+
+const uint16_t *tft_blend_lut(uint16_t fg, uint16_t bg, int levels);
+
+// Span kernels, operate on cnt pixels starting at dst
+
+void tft_span_fill(uint16_t *dst, int cnt, uint16_t color);
+void tft_span_blend(uint16_t *dst, int cnt, uint16_t color, uint8_t alpha);
+void tft_span_blend_mask(uint16_t *dst, const uint8_t *mask, int cnt, uint16_t color);
+
+// Shapes
+
+int tft_rect_alpha(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        uint16_t color, uint8_t alpha);
+
+int tft_line_aa(spi_device_handle_t spi, int xx, int yy, int xx2, int yy2,
+                        uint16_t color);
+
+int tft_blit_alpha(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        const uint8_t *mask, int stride, uint16_t color);
+
+// EOF
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////
+// Table driven bit to pixel expansion
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_system.h"
+
+#include "tft_expand.h"
+
+// Pixel pair masks. [scale - 1][nibble][word], a nibble at scale s
+// covers 4 * s pixels, 2 * s words. Low half word is the left pixel.
+
+static uint32_t exp_tab[TFT_EXPAND_MAX_SCALE][16][2 * TFT_EXPAND_MAX_SCALE];
+static uint8_t  exp_ready[TFT_EXPAND_MAX_SCALE];
+
+static void build_table(int scale)
+
+{
+    for(int nib = 0; nib < 16; nib++)
+        {
+        for(int word = 0; word < 2 * scale; word++)
+            {
+            int bit1 = (2 * word) / scale, bit2 = (2 * word + 1) / scale;
+            uint32_t mask = 0;
+            if(nib & (8 >> bit1)) mask |= 0x0000ffff;
+            if(nib & (8 >> bit2)) mask |= 0xffff0000;
+            exp_tab[scale - 1][nib][word] = mask;
+            }
+        }
+    exp_ready[scale - 1] = true;
+}
+
+// Any scale, one pixel at a time
+
+static int  expand_plain(uint16_t *dst, const uint8_t *bits, int nbits, int scale,
+                            uint16_t fg, uint16_t bg)
+
+{
+    for(int loop = 0; loop < nbits; loop++)
+        {
+        uint16_t cc = (bits[loop >> 3] & (0x80 >> (loop & 7))) ? fg : bg;
+        for(int loop2 = 0; loop2 < scale; loop2++)
+            *dst++ = cc;
+        }
+    return nbits * scale;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int tft_expand_row(uint16_t *dst, const uint8_t *bits, int nbits, int scale,
+                            uint16_t fg, uint16_t bg)
+
+{
+    if(scale < 1)
+        return 0;
+    if(scale > TFT_EXPAND_MAX_SCALE)
+        return expand_plain(dst, bits, nbits, scale, fg, bg);
+
+    if(!exp_ready[scale - 1])
+        build_table(scale);
+
+    uint32_t bg2 = bg | ((uint32_t)bg << 16);
+    uint32_t xor2 = bg2 ^ (fg | ((uint32_t)fg << 16));
+    uint32_t *dst2 = (uint32_t *)dst;
+    int words = 2 * scale;
+
+    for(int loop = 0; loop < nbits; loop += 8)
+        {
+        uint8_t byte = *bits++;
+        const uint32_t *hi = exp_tab[scale - 1][byte >> 4];
+
+        // Background only rows are common, skip the table
+        if(byte == 0)
+            {
+            int cnt = (nbits - loop > 4) ? 2 * words : words;
+            for(int loop2 = 0; loop2 < cnt; loop2++)
+                *dst2++ = bg2;
+            continue;
+            }
+        for(int loop2 = 0; loop2 < words; loop2++)
+            *dst2++ = bg2 ^ (xor2 & hi[loop2]);
+
+        if(nbits - loop > 4)
+            {
+            const uint32_t *lo = exp_tab[scale - 1][byte & 0xf];
+            for(int loop2 = 0; loop2 < words; loop2++)
+                *dst2++ = bg2 ^ (xor2 & lo[loop2]);
+            }
+        }
+    return nbits * scale;
+}
+
+// EOF
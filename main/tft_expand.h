@@ -0,0 +1,21 @@
+//////////////////////////////////////////////////////////////////////////
+// Bit to pixel expansion for 1 bit bitmaps. (glyphs, icons)
+//
+// Each nibble of the bitmap goes through a mask table into 4 * scale
+// pixels, written as 32 bit stores picking fg or bg with one and/xor.
+// Tables for scales up to TFT_EXPAND_MAX_SCALE are built on first use,
+// larger scales take a plain loop.
+
+#define TFT_EXPAND_MAX_SCALE    4
+
+// Pixels written for nbits at scale (whole nibbles)
+
+#define TFT_EXPAND_PIXELS(nbits, scale)  ((((nbits) + 3) & ~3) * (scale))
+
+// Expand nbits (MSB first) into dst, which must be 32 bit aligned and
+// hold TFT_EXPAND_PIXELS(nbits, scale) pixels. Returns nbits * scale.
+
+int tft_expand_row(uint16_t *dst, const uint8_t *bits, int nbits, int scale,
+                            uint16_t fg, uint16_t bg);
+
+// EOF
@@ -0,0 +1,128 @@
+//////////////////////////////////////////////////////////////////////////
+// Gradient and pattern fills from template rows
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_blend.h"
+#include "tft_fill.h"
+
+// Returns false if nothing is left after clipping
+
+static int clip_rect(int *xx, int *yy, int *ww, int *hh)
+
+{
+    if(*xx < 0) { *ww += *xx; *xx = 0; }
+    if(*yy < 0) { *hh += *yy; *yy = 0; }
+    if(*xx + *ww > SCREEN_WIDTH)  *ww = SCREEN_WIDTH - *xx;
+    if(*yy + *hh > SCREEN_HEIGHT) *hh = SCREEN_HEIGHT - *yy;
+
+    return *ww > 0 && *hh > 0;
+}
+
+// Colors for positions [offs, offs + cnt) of a total long gradient
+
+static void grad_template(uint16_t *dst, int offs, int cnt, int total,
+                                uint16_t color, uint16_t color2)
+
+{
+    int span = total > 1 ? total - 1 : 1;
+
+    for(int loop = 0; loop < cnt; loop++)
+        dst[loop] = tft_blend(color2, color, ((offs + loop) * 255) / span);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Linear gradient. Horizontal builds the first row and copies it down,
+// vertical keeps a column of colors and solid fills each row with it.
+
+int tft_gradient(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        uint16_t color, uint16_t color2, int dir)
+
+{
+    int org_x = xx, org_y = yy, org_w = ww, org_h = hh;
+
+    if(!clip_rect(&xx, &yy, &ww, &hh))
+        return -1;
+
+    if(dir == TFT_GRAD_HORIZ)
+        {
+        // Template is the visible part of the unclipped gradient
+        uint16_t *first = TFT_FB_ROW(yy) + xx;
+        grad_template(first, xx - org_x, ww, org_w, color, color2);
+        for(int loop = yy + 1; loop < yy + hh; loop++)
+            memcpy(TFT_FB_ROW(loop) + xx, first, ww * sizeof(uint16_t));
+        }
+    else
+        {
+        int span = org_h > 1 ? org_h - 1 : 1;
+        for(int loop = yy; loop < yy + hh; loop++)
+            {
+            uint16_t cc = tft_blend(color2, color, ((loop - org_y) * 255) / span);
+            tft_span_fill(TFT_FB_ROW(loop) + xx, ww, cc);
+            }
+        }
+    if(spi)
+        return tft_flush_rect(spi, xx, yy, ww, hh);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Repeating pattern of pw x ph pixels, anchored at the rectangle origin.
+// The first ph rows are expanded across by doubling copies, the rest
+// of the rows are copies of those.
+
+int tft_pattern(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        const uint16_t *pat, int pw, int ph)
+
+{
+    int org_x = xx, org_y = yy;
+
+    if(pw <= 0 || ph <= 0)
+        return -1;
+    if(!clip_rect(&xx, &yy, &ww, &hh))
+        return -1;
+
+    int phase = (xx - org_x) % pw;
+    int tmpl = MIN(ph, hh);
+
+    for(int loop = 0; loop < tmpl; loop++)
+        {
+        const uint16_t *src = pat + ((yy - org_y + loop) % ph) * pw;
+        uint16_t *dst = TFT_FB_ROW(yy + loop) + xx;
+
+        // Seed one period, then double it
+        int done = MIN(pw - phase, ww);
+        memcpy(dst, src + phase, done * sizeof(uint16_t));
+        if(done < ww)
+            {
+            int cnt = MIN(phase, ww - done);
+            memcpy(dst + done, src, cnt * sizeof(uint16_t));
+            done += cnt;
+            }
+        while(done < ww)
+            {
+            int cnt = MIN(done, ww - done);
+            memcpy(dst + done, dst, cnt * sizeof(uint16_t));
+            done += cnt;
+            }
+        }
+    for(int loop = tmpl; loop < hh; loop++)
+        {
+        memcpy(TFT_FB_ROW(yy + loop) + xx,
+                    TFT_FB_ROW(yy + loop - ph) + xx, ww * sizeof(uint16_t));
+        }
+    if(spi)
+        return tft_flush_rect(spi, xx, yy, ww, hh);
+    return 0;
+}
+
+// EOF
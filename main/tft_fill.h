@@ -0,0 +1,18 @@
+//////////////////////////////////////////////////////////////////////////
+// Gradient and pattern fills.
+//
+// Each fill computes one template (a row, or a column of colors)
+// and replicates it with row copies, so the cost is close to a solid
+// fill. Template rows are built in place in the screen memory.
+// Pass spi as NULL to compose only. (see tft_blend.h)
+
+#define TFT_GRAD_HORIZ  0       // Color changes left to right
+#define TFT_GRAD_VERT   1       // Color changes top to bottom
+
+int tft_gradient(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        uint16_t color, uint16_t color2, int dir);
+
+int tft_pattern(spi_device_handle_t spi, int xx, int yy, int ww, int hh,
+                        const uint16_t *pat, int pw, int ph);
+
+// EOF
@@ -15,6 +15,9 @@
 
 #include "tft_base.h"
 #include "tft_fonts.h"
+#include "tft_gcache.h"
+#include "tft_expand.h"
+#include "tft_blend.h"
 
 // Set this to true for double buffering ...
 
@@ -23,317 +26,668 @@ int  fontback = TFT_BLACK;
 int  was_error = false;
 char *err_str = "";
 
-static void drawLine(int xx, int yy, int ww, uint16_t color)
+// Expansion scratch, one cell row. Aligned for the 32 bit stores.
+
+static uint32_t rowbuf[SCREEN_WIDTH];
+
+//////////////////////////////////////////////////////////////////////////
+// Font registry, indexed by font ID. The built in ones are there
+// from the start, more can be added with tft_font_register().
+// Packed fonts leave the raw tables unreferenced, the linker drops them.
+
+static const tft_font_t *fonts[TFT_FONT_MAX] = 
 {
-    if(xx >= 0 && yy >= 0 && xx < 320 && yy < SCREEN_HEIGHT)
+    [TFT_FONT_16]  = &tft_font_f16,
+#ifdef CONFIG_TFT_FONT_PACKED
+    [TFT_FONT_32]  = &tft_font_f32pk,
+    [TFT_FONT_64]  = &tft_font_f64pk,
+    [TFT_FONT_128] = &tft_font_f128pk,
+#else
+    [TFT_FONT_32]  = &tft_font_f32,
+    [TFT_FONT_64]  = &tft_font_f64,
+    [TFT_FONT_128] = &tft_font_f128,
+#endif
+    [TFT_FONT_SANS24] = &tft_font_sans24,
+    [TFT_FONT_SANS12AA] = &tft_font_sans12aa,
+};
+
+int     tft_font_register(const tft_font_t *font)
+
+{
+    if(font->id < 0 || font->id >= TFT_FONT_MAX)
         {
-        for(int loop = 0; loop < ww; loop++)
-            {
-            if(yy < SCREEN_HEIGHT / 2)
-                (*pscreen)[yy][xx + loop] = color;
-            else
-                (*pscreen2)[yy - SCREEN_HEIGHT / 2][xx + loop] = color;
-            }
+        printf("Invalid font id %d\n", font->id);
+        return -1;
         }
+    fonts[font->id] = font;
+    return 0;
 }
-        
-static void drawPixel(spi_device_handle_t spi, int xx, int yy, uint16_t color)
+
+const tft_font_t *tft_font_get(int id)
 
 {
-    if(xx >= 0 && yy >= 0 && xx < 320 && yy < 240)
-        {
-        if(yy < 240 / 2)
-                (*pscreen)[yy][xx] = color;
-            else
-                (*pscreen2)[yy - SCREEN_HEIGHT / 2][xx] = color;
-                
-        if(!doublebuff)
-            {
-            tft_rect(spi, xx, yy, 1, 1, color);
-            }
-        }
-    else
+    if(id < 0 || id >= TFT_FONT_MAX)
+        return NULL;
+    return fonts[id];
+}
+
+// Legacy size numbers to font
+
+const tft_font_t *tft_font_by_size(int size)
+
+{
+    const tft_font_t *font = NULL;
+    
+    switch(size)
         {
-        //printf("Parm err on drawpixel %d %d\n", xx, yy);
-        was_error = true;
+        case 16:  font = fonts[TFT_FONT_16];  break;
+        case 32:  font = fonts[TFT_FONT_32];  break;
+        case 64:  font = fonts[TFT_FONT_64];  break;
+        case 128: font = fonts[TFT_FONT_128]; break;
         }
+    if(font == NULL)
+        printf("Invalid font spec %d\n", size);
+    return font;
 }
 
-int draw_str(spi_device_handle_t spi, uint8_t *sss, int size, int xx, int yy, uint16_t color)
+//////////////////////////////////////////////////////////////////////////
+// Fallback chain, by registry slot. -1 ends the chain.
 
+static signed char fallbacks[TFT_FONT_MAX] = 
 {
-    int pos = xx, wwww, hhhh;
-    
-    //printf("draw_str '%s' size=%d %d %d\n", sss, size, xx, yy); 
-    
-    was_error = false;
-    err_str = "";
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+int     tft_font_set_fallback(int id, int fallback)
+
+{
+    if(id < 0 || id >= TFT_FONT_MAX || fallback >= TFT_FONT_MAX || id == fallback)
+        return -1;
+    fallbacks[id] = fallback;
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Decode one UTF-8 character, advance the pointer past it. Bytes that 
+// do not start a valid sequence are taken as Latin-1 (raw SSIDs).
+
+uint32_t tft_utf8_next(const uint8_t **sss)
+
+{
+    const uint8_t *ptr = *sss;
+    uint32_t code = *ptr++;
+    int more = 0;
     
-    while(true)
+    if(code < 0x80)
         {
-        uint8_t chh = *sss;
-         
-        if(chh == '\0')
-            break;
-            
-        if(chh >= 127)
-            chh = '.';
-            
-        if(chh < 0x20)
-            chh = '~';
-            
-        if(chh == '_')
-            chh = '-';
-        
-        draw_char(spi, chh, size, pos, yy, color);
-        draw_char_extent(chh, size, &wwww, &hhhh);
-        pos += wwww;
-        sss++;
+        *sss = ptr;
+        return code;
         }
-        
-    // Output after the whole string is compiled
-    if(doublebuff)
+    if((code & 0xe0) == 0xc0)       { code &= 0x1f; more = 1; }
+    else if((code & 0xf0) == 0xe0)  { code &= 0x0f; more = 2; }
+    else if((code & 0xf8) == 0xf0)  { code &= 0x07; more = 3; }
+    else
         {
-        //printf("Double buff %d %d ww %d hh %d\n", xx, yy, pos, size);
-        tft_range parm;
-        
-        parm.spi = spi; parm.hhh = 1;
-        parm.xpos = xx; parm.www = pos - xx; 
-            
-        for(int loop = 0; loop < hhhh; loop++)
-            {
-            parm.ypos = yy + loop;
-            
-            if(yy + loop < SCREEN_HEIGHT / 2)
-                parm.line = &(*pscreen)[yy + loop][xx];
-            else
-                parm.line = &(*pscreen2)[yy + loop - SCREEN_HEIGHT/2][xx];
-            
-            send_block(&parm);
-            }
+        *sss = ptr;
+        return code;
         }
-    if(was_error)
+    for(int loop = 0; loop < more; loop++)
         {
-        printf("Error %s on TFT operation.\n", err_str);
+        if((ptr[loop] & 0xc0) != 0x80)
+            {
+            // Broken sequence, just the lead byte
+            *sss = ptr;
+            return (*sss)[-1];
+            }
+        code = (code << 6) | (ptr[loop] & 0x3f);
         }
-    return pos;
+    *sss = ptr + more;
+    return code;
 }
 
-int draw_str_extent(uint8_t *sss, int size, int *www, int *hhh)
+//////////////////////////////////////////////////////////////////////////
+// Code point to glyph index in one font, -1 if not there. Ranges are 
+// binary searched; consecutive characters mostly hit the same range, 
+// so the last hit is tried first.
+
+static const tft_font_t *hit_font;
+static int  hit_range;
+
+static int  glyph_index(const tft_font_t *font, uint32_t code)
 
 {
-    int pos = 0, wwww, hhhh;
-    while(true)
+    if(font->ranges == NULL)
         {
-        if(*sss == '\0')
-            break;
-        draw_char_extent(*sss, size, &wwww, &hhhh);
-        pos += wwww;
-        sss++;
+        if(code >= font->first && code < font->first + font->count)
+            return code - font->first;
+        return -1;
         }
-    *www = pos; *hhh = hhhh;    
-    return pos;
+    const tft_font_range_t *rr;
+    
+    if(hit_font == font)
+        {
+        rr = &font->ranges[hit_range];
+        if(code >= rr->first && code < rr->first + rr->count)
+            return rr->index + code - rr->first;
+        }
+    int lo = 0, hi = font->nranges - 1;
+    while(lo <= hi)
+        {
+        int mid = (lo + hi) / 2;
+        rr = &font->ranges[mid];
+        if(code < rr->first)
+            hi = mid - 1;
+        else if(code >= rr->first + rr->count)
+            lo = mid + 1;
+        else
+            {
+            hit_font = font; hit_range = mid;
+            return rr->index + code - rr->first;
+            }
+        }
+    return -1;
 }
 
-//////////////////////////////////////////////////////////////////////////
-//
+// Latin-1 letters (0xC0 - 0xFF) to their ASCII base letter
 
-int draw_char_extent(uint8_t chh, int size, int *www, int *hhh)
+static const char fold_latin1[65] = 
+            "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYPs"
+            "aaaaaaaceeeeiiiidnooooo/ouuuuypy";
+
+// Font in the chain that has the character, its glyph index in idx.
+// Unprintable and missing ones map the way they always have.
+
+static const tft_font_t *glyph_find(const tft_font_t *font, uint32_t code, int *idx)
 
 {
-    uint16_t width = 0, height = 0;
-    uint16_t uniCode = chh - 32;
-    const uint8_t *flash_address = 0;
-    int8_t gap = 0, dup = 1;
-    
-    if(size == 128)
-        {
-        flash_address = chrtbl_f64[uniCode];
-        width = *(widtbl_f64+uniCode);
-        height = chr_hgt_f64;
-        gap = -3;
-        dup = 2;
-        }
-    else if(size == 64)
+    if(code < 0x20)
+        code = '~';
+    else if(code == 127)
+        code = '.';
+    else if(code == '_')
+        code = '-';
+        
+    // ASCII in a plain font, the common case
+    if(code < 0x80 && font->ranges == NULL && 
+            code >= font->first && code < font->first + font->count)
         {
-        flash_address = chrtbl_f64[uniCode];
-        width = *(widtbl_f64+uniCode);
-        height = chr_hgt_f64;
-        gap = -3;
+        *idx = code - font->first;
+        return font;
         }
-    else if(size == 32)
+    // The character, its ASCII fold, then the '.' placeholder
+    for(int pass = 0; pass < 3; pass++)
         {
-        flash_address = chrtbl_f32[uniCode];
-        width = *(widtbl_f32+uniCode);
-        height = chr_hgt_f32;
-        gap = -3;
+        const tft_font_t *ff = font;
+        for(int hops = 0; ff != NULL && hops < TFT_FONT_MAX; hops++)
+            {
+            if((*idx = glyph_index(ff, code)) >= 0)
+                return ff;
+            int next = (ff->id >= 0 && ff->id < TFT_FONT_MAX) ? fallbacks[ff->id] : -1;
+            ff = next >= 0 ? fonts[next] : NULL;
+            }
+        if(pass == 0 && code >= 0xc0 && code <= 0xff)
+            code = fold_latin1[code - 0xc0];
+        else
+            code = '.';
         }
-    else if(size == 16)
+    *idx = 0;
+    return font;
+}
+
+// By glyph index
+
+#define GLYPH_WIDTH(font, idx) ((font)->format != TFT_FONT_FMT_FIXED ?   \
+    (font)->glyphs[idx].xadvance : (font)->widtbl[idx])
+                
+#define CHAR_ADVANCE(font, idx) \
+    (GLYPH_WIDTH(font, idx) * (font)->scale + (font)->gap)
+
+#define FONT_HEIGHT(font)   ((font)->height * (font)->scale)
+
+//////////////////////////////////////////////////////////////////////////
+// Copy a rendered cell row to the memory buffer, or to the screen 
+// memory (clipped to the visible columns left to right)
+
+static inline void put_row(const uint16_t *row, int ww, int yyy, uint16_t *mem, 
+                    int stride, int xx, int yy, int left, int right)
+
+{
+    if(mem)
         {
-        flash_address = chrtbl_f16[uniCode];
-        width = *(widtbl_f16+uniCode);
-        height = chr_hgt_f16;
-        gap = 1;
+        memcpy(mem + yyy * stride, row, ww * sizeof(uint16_t));
         }
-    else
+    else if(yy + yyy >= 0 && yy + yyy < SCREEN_HEIGHT && right > left)
         {
-        printf("Invalid font spec %d\n", size);
-        
-        //flash_address = chrtbl_f7s[uniCode];
-        //width = *(widtbl_f7s+uniCode);
-        //height = chr_hgt_f7s;
-        //gap = 2;
+        memcpy(TFT_FB_ROW(yy + yyy) + xx + left, row + left, 
+                            (right - left) * sizeof(uint16_t));
         }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fixed cell font. Each glyph row is expanded once (scaled across by 
+// the expand kernel) then copied to scale destination rows.
+
+static int  render_fixed(const tft_font_t *font, int idx, uint16_t *mem, 
+                    int stride, int xx, int yy, uint16_t color, uint16_t back)
+
+{
+    const uint8_t *flash_address = font->chrtbl[idx]; 
+    int width = font->widtbl[idx], dup = font->scale;
         
-    // Stop warnings
-    (void) flash_address;
+    int ww = width * dup + font->gap;
+    int bytes = font->bytes ? font->bytes : (width + 7) / 8;
+    if(ww <= 0 || TFT_EXPAND_PIXELS(width, dup) > 2 * SCREEN_WIDTH)
+        return -1;
     
-    *www = width * dup + gap;
-    *hhh = height * dup;
-    //printf("size %d extent %d %d\n", size, *www, *hhh);
-    return width * dup + gap;
-}                            
+    // Visible columns when going to the screen
+    int left = MAX(0, -xx), right = MIN(ww, SCREEN_WIDTH - xx);
+    uint16_t *row = (uint16_t *)rowbuf;
+     
+    for(int loop = 0; loop < font->height; loop++)
+        {
+        int done = tft_expand_row(row, flash_address + loop * bytes, 
+                                                width, dup, color, back);
+        // Positive gap is background
+        for(; done < ww; done++)
+            row[done] = back;
+            
+        for(int dd = 0; dd < dup; dd++)
+            put_row(row, ww, loop * dup + dd, mem, stride, xx, yy, left, right);
+        }
+    return ww;
+}
 
 //////////////////////////////////////////////////////////////////////////
-//
+// Adafruit GFX font. Only the glyph box has bits; rows outside it are 
+// background, filled once and reused. Inside the box the bits are 
+// taken a byte at a time (rows are not byte aligned) and empty bytes 
+// skipped, so only the foreground pixels are written over the fill.
 
-int draw_char(spi_device_handle_t spi, uint8_t chh, int size, int xx, int yy, uint16_t color)
+static int  render_gfx(const tft_font_t *font, int idx, uint16_t *mem, 
+                    int stride, int xx, int yy, uint16_t color, uint16_t back)
 
 {
-    uint16_t width = 0, height = 0, dup = 1;
-    uint16_t uniCode = chh -32;
-    const uint8_t *flash_address = 0;
-    int8_t gap = 0;
+    const tft_gfx_glyph_t *glyph = &font->glyphs[idx];
+    const uint8_t *bits = font->bitmap + glyph->offset;
+    int dup = font->scale;
     
-    //printf("draw '%c' %d %d %d 0x%x\n", chh, size, xx, yy, color);    
+    int ww = glyph->xadvance * dup + font->gap;
+    if(ww <= 0 || ww > SCREEN_WIDTH)
+        return -1;
+        
+    int left = MAX(0, -xx), right = MIN(ww, SCREEN_WIDTH - xx);
+    int top = font->baseline + glyph->yoffset;
+    uint16_t *row = (uint16_t *)rowbuf;
+    int blank = false;
     
-    if(size == 128)
-        {     
-        // Fake larger char by duplicating font            
-        flash_address = chrtbl_f64[uniCode];
-        width = *(widtbl_f64+uniCode);
-        height = chr_hgt_f64;
-        gap = -3;
-        dup = 2;
-        }
-    else if(size == 64)
-        {                 
-        flash_address = chrtbl_f64[uniCode];
-        width = *(widtbl_f64+uniCode);
-        height = chr_hgt_f64;
-        gap = -3;
-        }
-    else if(size == 32)
-        {
-        flash_address = chrtbl_f32[uniCode];
-        width = *(widtbl_f32+uniCode);
-        height = chr_hgt_f32;
-        gap = -3;
-        }
-    else if(size == 16)
+    for(int loop = 0; loop < font->height; loop++)
         {
-        flash_address = chrtbl_f16[uniCode];
-        width = *(widtbl_f16+uniCode);
-        height = chr_hgt_f16;
-        gap = 1;
-        }
-    else
-        {
-        printf("Invalid font spec %d\n", size);
-        //flash_address = chrtbl_f7s[uniCode];
-        //width = *(widtbl_f7s+uniCode);
-        //height = chr_hgt_f7s;
-        //gap = 2;
+        int gyy = loop - top;
+        if(gyy < 0 || gyy >= glyph->height)
+            {
+            if(!blank)
+                tft_span_fill(row, ww, back);
+            blank = true;
+            }
+        else
+            {
+            tft_span_fill(row, ww, back);
+            blank = false;
+            
+            int bit = gyy * glyph->width;
+            for(int col = 0; col < glyph->width; )
+                {
+                uint8_t val = bits[bit >> 3] << (bit & 7);
+                int avail = MIN(8 - (bit & 7), glyph->width - col);
+                int pxx = (glyph->xoffset + col) * dup;
+                
+                // Solid byte inside the cell is one run
+                if(val == 0xff && avail == 8 && pxx >= 0 && pxx + 8 * dup <= ww)
+                    {
+                    tft_span_fill(row + pxx, 8 * dup, color);
+                    val = 0;
+                    }
+                for(int cnt = avail; val != 0 && cnt > 0; cnt--)
+                    {
+                    if(val & 0x80)
+                        {
+                        for(int dd = 0; dd < dup; dd++)
+                            if(pxx + dd >= 0 && pxx + dd < ww)
+                                row[pxx + dd] = color;
+                        }
+                    val <<= 1; pxx += dup;
+                    }
+                col += avail; bit += avail;
+                }
+            }
+        for(int dd = 0; dd < dup; dd++)
+            put_row(row, ww, loop * dup + dd, mem, stride, xx, yy, left, right);
         }
+    return ww;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Anti aliased font, GFX layout with bpp coverage bits per pixel. The 
+// blend table for the color pair is looked up once per glyph, each 
+// pixel is then a table read. Zero coverage is the background fill, 
+// so empty bytes are skipped like on the 1 bit path.
+
+static int  render_aa(const tft_font_t *font, int idx, uint16_t *mem, 
+                    int stride, int xx, int yy, uint16_t color, uint16_t back)
+
+{
+    const tft_gfx_glyph_t *glyph = &font->glyphs[idx];
+    const uint8_t *bits = font->bitmap + glyph->offset;
+    int bpp = font->bpp, mask = (1 << bpp) - 1, dup = font->scale;
+    
+    int ww = glyph->xadvance * dup + font->gap;
+    if(ww <= 0 || ww > SCREEN_WIDTH)
+        return -1;
         
-    uint16_t w  = (width + 7) / 8;
-    uint16_t pX = 0;
-    uint16_t pY = yy;
-    uint8_t line = 0;
-  
-    for(int i = 0; i < height; i++)
+    const uint16_t *lut = tft_blend_lut(color, back, 1 << bpp);
+    if(lut == NULL)
+        return -1;
+        
+    int left = MAX(0, -xx), right = MIN(ww, SCREEN_WIDTH - xx);
+    int top = font->baseline + glyph->yoffset;
+    uint16_t *row = (uint16_t *)rowbuf;
+    int blank = false;
+    
+    // Glyph box inside the cell, unscaled: no per pixel checks
+    int fast = dup == 1 && glyph->xoffset >= 0 && 
+                                glyph->xoffset + glyph->width <= ww;
+    int perbyte = 8 / bpp;
+    
+    for(int loop = 0; loop < font->height; loop++)
         {
-        if(dup == 2)
+        int gyy = loop - top;
+        if(gyy < 0 || gyy >= glyph->height)
             {
-            drawLine(xx, pY,  2 * width + gap, fontback);
-            drawLine(xx , pY + 1, 2 * width + gap, fontback);
+            if(!blank)
+                tft_span_fill(row, ww, back);
+            blank = true;
             }
-        else
+        else if(fast)
             {
-            drawLine(xx, pY, width + gap, fontback);
-            }
+            tft_span_fill(row, ww, back);
+            blank = false;
             
-        for (int k = 0; k < w; k++)
-            {
-            line = *(flash_address + w*i + k);
-            if(line) 
+            uint16_t *dst = row + glyph->xoffset;
+            int bit = gyy * glyph->width * bpp;
+            for(int col = 0; col < glyph->width; col++, bit += bpp)
                 {
-                pX = xx + k*8;
-                    
-                if(dup == 2)
+                uint8_t val = bits[bit >> 3];
+                
+                // Whole empty byte
+                if(val == 0 && (bit & 7) == 0 && col + perbyte <= glyph->width)
                     {
-                    int pX2 = xx + k*16, pY2 = pY;
-                    // Draw 4 pixels
-                    if(line & 0x80) drawPixel(spi, pX2+0,  pY2, color);
-                    if(line & 0x80) drawPixel(spi, pX2+0,  pY2+1, color);
-                    if(line & 0x80) drawPixel(spi, pX2+1,  pY2, color);
-                    if(line & 0x80) drawPixel(spi, pX2+1,  pY2+1, color);
-                    if(line & 0x40) drawPixel(spi, pX2+2,  pY2, color);
-                    if(line & 0x40) drawPixel(spi, pX2+2,  pY2+1, color);
-                    if(line & 0x40) drawPixel(spi, pX2+3,  pY2, color);
-                    if(line & 0x40) drawPixel(spi, pX2+3,  pY2+1, color);
-                    if(line & 0x20) drawPixel(spi, pX2+4,  pY2, color);
-                    if(line & 0x20) drawPixel(spi, pX2+4,  pY2+1, color);
-                    if(line & 0x20) drawPixel(spi, pX2+5,  pY2, color);
-                    if(line & 0x20) drawPixel(spi, pX2+5,  pY2+1, color);
-                    if(line & 0x10) drawPixel(spi, pX2+6,  pY2, color);
-                    if(line & 0x10) drawPixel(spi, pX2+6,  pY2+1, color);
-                    if(line & 0x10) drawPixel(spi, pX2+7,  pY2, color);
-                    if(line & 0x10) drawPixel(spi, pX2+7,  pY2+1, color);
-                    if(line & 0x8)  drawPixel(spi, pX2+8,  pY2, color);
-                    if(line & 0x8)  drawPixel(spi, pX2+8,  pY2+1, color);
-                    if(line & 0x8)  drawPixel(spi, pX2+9,  pY2, color);
-                    if(line & 0x8)  drawPixel(spi, pX2+9,  pY2+1, color);
-                    if(line & 0x4)  drawPixel(spi, pX2+10, pY2, color);
-                    if(line & 0x4)  drawPixel(spi, pX2+10, pY2+1, color);
-                    if(line & 0x4)  drawPixel(spi, pX2+11, pY2, color);
-                    if(line & 0x4)  drawPixel(spi, pX2+11, pY2+1, color);
-                    if(line & 0x2)  drawPixel(spi, pX2+12, pY2, color);
-                    if(line & 0x2)  drawPixel(spi, pX2+12, pY2+1, color);
-                    if(line & 0x2)  drawPixel(spi, pX2+13, pY2, color);
-                    if(line & 0x2)  drawPixel(spi, pX2+13, pY2+1, color);
-                    if(line & 0x1)  drawPixel(spi, pX2+14, pY2, color);
-                    if(line & 0x1)  drawPixel(spi, pX2+14, pY2+1, color);
-                    if(line & 0x1)  drawPixel(spi, pX2+15, pY2, color);
-                    if(line & 0x1)  drawPixel(spi, pX2+15, pY2+1, color);
+                    col += perbyte - 1; bit += 8 - bpp;
+                    continue;
                     }
-                else
+                int level = (val >> (8 - bpp - (bit & 7))) & mask;
+                if(level)
+                    dst[col] = lut[level];
+                }
+            }
+        else
+            {
+            tft_span_fill(row, ww, back);
+            blank = false;
+            
+            int bit = gyy * glyph->width * bpp;
+            int pxx = glyph->xoffset * dup;
+            for(int col = 0; col < glyph->width; )
+                {
+                // Pixels left in this byte
+                uint8_t val = bits[bit >> 3] << (bit & 7);
+                int avail = MIN((8 - (bit & 7)) / bpp, glyph->width - col);
+                
+                for(int cnt = avail; val != 0 && cnt > 0; cnt--)
                     {
-                    if(line & 0x80) drawPixel(spi, pX+0, pY, color);
-                    if(line & 0x40) drawPixel(spi, pX+1, pY, color);
-                    if(line & 0x20) drawPixel(spi, pX+2, pY, color);
-                    if(line & 0x10) drawPixel(spi, pX+3, pY, color);
-                    if(line & 0x8)  drawPixel(spi, pX+4, pY, color);
-                    if(line & 0x4)  drawPixel(spi, pX+5, pY, color);
-                    if(line & 0x2)  drawPixel(spi, pX+6, pY, color);
-                    if(line & 0x1)  drawPixel(spi, pX+7, pY, color);
+                    int level = (val >> (8 - bpp)) & mask;
+                    if(level)
+                        {
+                        for(int dd = 0; dd < dup; dd++)
+                            if(pxx + dd >= 0 && pxx + dd < ww)
+                                row[pxx + dd] = lut[level];
+                        }
+                    val <<= bpp; pxx += dup;
                     }
-                } 
+                // Skipped the zero tail (if any)
+                pxx = (glyph->xoffset + col + avail) * dup;
+                col += avail; bit += avail * bpp;
+                }
             }
-        pY++;
-        if(dup == 2) pY++;
-    }
-    //printf("ret+gap = %d %c\n", width+gap, chh);
-    return width + gap ;        // increment x coord
+        for(int dd = 0; dd < dup; dd++)
+            put_row(row, ww, loop * dup + dd, mem, stride, xx, yy, left, right);
+        }
+    return ww;
 }
 
-// EOF
+//////////////////////////////////////////////////////////////////////////
+// Render a character cell, background included. Into mem (stride 
+// pixels) if given, into the screen memory at xx, yy (clipped) 
+// otherwise. Returns the advance.
 
+static int  render_cell(const tft_font_t *font, int idx, uint16_t *mem, 
+                    int stride, int xx, int yy, uint16_t color, uint16_t back)
 
+{
+    if(font->format == TFT_FONT_FMT_GFX)
+        return render_gfx(font, idx, mem, stride, xx, yy, color, back);
+    if(font->format == TFT_FONT_FMT_AA)
+        return render_aa(font, idx, mem, stride, xx, yy, color, back);
+    return render_fixed(font, idx, mem, stride, xx, yy, color, back);
+}
 
+//////////////////////////////////////////////////////////////////////////
+// Next code point, ASCII without the decoder call
 
+#define NEXT_CODE(sss)  (*(sss) < 0x80 ? *(sss)++ : tft_utf8_next(&(sss)))
 
+//////////////////////////////////////////////////////////////////////////
+// Lay out and render a UTF-8 string into the screen memory, no LCD 
+// traffic. Advances summed in the same pass. Returns the end x 
+// position, the text box height (tallest font used) in hhh.
+
+int draw_text_render(const tft_font_t *font, uint8_t *sss, int xx, int yy, 
+                            uint16_t color, int *hhh)
 
+{
+    const uint8_t *ptr = sss;
+    int pos = xx;
+    
+    *hhh = 0;
+    if(font == NULL)
+        return xx;
+        
+    *hhh = FONT_HEIGHT(font);
+    while(*ptr != '\0')
+        {
+        int idx; uint32_t code = NEXT_CODE(ptr);
+        const tft_font_t *gfont = glyph_find(font, code, &idx);
+        
+        pos += font_glyph_draw(gfont, idx, pos, yy, color, fontback);
+        if(gfont != font)
+            *hhh = MAX(*hhh, FONT_HEIGHT(gfont));
+        }
+    return pos;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Render the string, then send the text box to the LCD as one region
 
+int draw_text(spi_device_handle_t spi, const tft_font_t *font, uint8_t *sss, 
+                            int xx, int yy, uint16_t color)
+
+{
+    int pos, hhhh;
+    
+    //printf("draw_text '%s' %d %d\n", sss, xx, yy); 
+    
+    was_error = false;
+    err_str = "";
+    
+    pos = draw_text_render(font, sss, xx, yy, color, &hhhh);
+        
+    // Output after the whole string is compiled
+    if(pos > xx)
+        tft_flush_rect(spi, xx, yy, pos - xx, hhhh);
+        
+    if(was_error)
+        {
+        printf("Error %s on TFT operation.\n", err_str);
+        }
+    return pos;
+}
+
+int draw_text_extent(const tft_font_t *font, uint8_t *sss, int *www, int *hhh)
+
+{
+    const uint8_t *ptr = sss;
+    int pos = 0, height;
+    
+    *www = *hhh = 0;
+    if(font == NULL)
+        return 0;
+        
+    height = FONT_HEIGHT(font);
+    while(*ptr != '\0')
+        {
+        int idx; uint32_t code = NEXT_CODE(ptr);
+        const tft_font_t *gfont = glyph_find(font, code, &idx);
+        
+        pos += CHAR_ADVANCE(gfont, idx);
+        height = MAX(height, FONT_HEIGHT(gfont));
+        }
+    *www = pos; *hhh = height;    
+    return pos;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+
+int font_glyph_extent(const tft_font_t *font, int idx, int *www, int *hhh)
+
+{
+    *www = CHAR_ADVANCE(font, idx);
+    *hhh = FONT_HEIGHT(font);
+    return *www;
+}
 
+int font_char_extent(const tft_font_t *font, uint32_t code, int *www, int *hhh)
 
+{
+    int idx;
+    
+    *www = *hhh = 0;
+    if(font == NULL)
+        return 0;
+    
+    font = glyph_find(font, code, &idx);
+    return font_glyph_extent(font, idx, www, hhh);
+}                            
+
+//////////////////////////////////////////////////////////////////////////
+// Font in the chain that has the character, its glyph index in idx
+
+const tft_font_t *font_glyph_find(const tft_font_t *font, uint32_t code, int *idx)
+
+{
+    return glyph_find(font, code, idx);
+}
+
+// Glyph cell into the screen memory. The cache paints the cell, falls 
+// back on uncacheable ones.
+
+int font_glyph_draw(const tft_font_t *font, int idx, int xx, int yy, 
+                            uint16_t color, uint16_t back)
+
+{
+    if(!gcache_enabled || tft_gcache_draw(font, idx, xx, yy, color, back) < 0)
+        render_cell(font, idx, NULL, 0, xx, yy, color, back);
+    return CHAR_ADVANCE(font, idx);
+}
+
+// Render the character cell (advance x height, background included)
+// into a memory buffer of stride pixels. Feeds the glyph cache.
+
+int font_glyph_render(const tft_font_t *font, int idx, uint16_t *dst, 
+                            int stride, uint16_t color, uint16_t back)
+
+{
+    return render_cell(font, idx, dst, stride, 0, 0, color, back);
+}
+
+int font_char_render(const tft_font_t *font, uint32_t code, uint16_t *dst, 
+                            int stride, uint16_t color, uint16_t back)
+
+{
+    int idx;
+    
+    if(font == NULL)
+        return -1;
+        
+    font = glyph_find(font, code, &idx);
+    return render_cell(font, idx, dst, stride, 0, 0, color, back);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Size based calls, kept for the existing callers
+
+int draw_str_render(uint8_t *sss, int size, int xx, int yy, uint16_t color, int *hhh)
+
+{
+    return draw_text_render(tft_font_by_size(size), sss, xx, yy, color, hhh);
+}
+
+int draw_str(spi_device_handle_t spi, uint8_t *sss, int size, int xx, int yy, uint16_t color)
+
+{
+    return draw_text(spi, tft_font_by_size(size), sss, xx, yy, color);
+}
+
+int draw_str_extent(uint8_t *sss, int size, int *www, int *hhh)
+
+{
+    return draw_text_extent(tft_font_by_size(size), sss, www, hhh);
+}
+
+int draw_char_extent(uint8_t chh, int size, int *www, int *hhh)
+
+{
+    return font_char_extent(tft_font_by_size(size), chh, www, hhh);
+}
+
+int draw_char_render(uint8_t chh, int size, uint16_t *dst, int stride, 
+                            uint16_t color, uint16_t back)
+
+{
+    return font_char_render(tft_font_by_size(size), chh, dst, stride, color, back);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Draw one character into the screen memory. Sent to the LCD right 
+// away if not double buffered.
+
+int draw_char(spi_device_handle_t spi, uint8_t chh, int size, int xx, int yy, uint16_t color)
+
+{
+    const tft_font_t *font = tft_font_by_size(size);
+    
+    //printf("draw '%c' %d %d %d 0x%x\n", chh, size, xx, yy, color);    
+    
+    if(font == NULL)
+        return -1;
+        
+    int idx;
+    font = glyph_find(font, chh, &idx);
+    int ww = render_cell(font, idx, NULL, 0, xx, yy, color, fontback);
+    
+    if(ww > 0 && !doublebuff)
+        tft_flush_rect(spi, xx, yy, ww, FONT_HEIGHT(font));
+        
+    return ww;        // increment x coord
+}
+
+// EOF
@@ -34,6 +34,88 @@ extern const unsigned char* chrtbl_f32[96];
 extern const unsigned char widtbl_f64[96];
 extern const unsigned char* chrtbl_f64[96];
 
+//////////////////////////////////////////////////////////////////////////
+// Font descriptors. Each font file carries its own, the registry maps
+// font IDs to them. Text calls take a descriptor (resolved once) and
+// need no per character dispatch. (drawing calls are in tft_base.h)
+
+#define TFT_FONT_16     0
+#define TFT_FONT_32     1
+#define TFT_FONT_64     2
+#define TFT_FONT_128    3       // Font64 at 2x
+#define TFT_FONT_SANS24 4       // DejaVu Sans 24pt, proportional
+#define TFT_FONT_SANS12AA 5     // Same, half size, anti aliased 4 bpp
+
+#define TFT_FONT_MAX    16      // Registry slots
+
+// Glyph formats
+
+#define TFT_FONT_FMT_FIXED  0   // Full cell rows, byte aligned (Font16 ...)
+#define TFT_FONT_FMT_GFX    1   // Adafruit GFX, bounding box bits packed
+#define TFT_FONT_FMT_AA     2   // GFX layout, bpp coverage per pixel
+
+// Adafruit GFX glyph. Offset into the bitmap, the box is width x height
+// at xoffset, yoffset from the pen position on the baseline. The AA 
+// fonts use it too, with bpp bits per pixel instead of one.
+
+typedef struct _tft_gfx_glyph_t
+
+{
+    unsigned short  offset;
+    unsigned char   width, height;
+    unsigned char   xadvance;
+    signed char     xoffset, yoffset;
+
+} tft_gfx_glyph_t;
+
+// Sparse code point range, for fonts beyond one run of characters. 
+// Sorted by first, code points first .. first + count - 1 are glyphs
+// index .. index + count - 1.
+
+typedef struct _tft_font_range_t
+
+{
+    unsigned int    first;
+    unsigned short  count;
+    unsigned short  index;
+
+} tft_font_range_t;
+
+typedef struct _tft_font_t
+
+{
+    int     id;                         // Registry slot
+    const unsigned char **chrtbl;       // Glyph rows, MSB left
+    const unsigned char *widtbl;        // Glyph widths
+    int     first, count;               // Character range
+    int     height;                     // Glyph rows
+    int     gap;                        // Added to each advance
+    int     scale;                      // Integer pixel scale
+    int     bytes;                      // Bytes per row, 0: from width
+    
+    int     format;                     // TFT_FONT_FMT_*
+    const unsigned char *bitmap;        // GFX, AA: packed glyph bits
+    const tft_gfx_glyph_t *glyphs;      // GFX, AA: per glyph metrics
+    int     baseline;                   // GFX, AA: rows above baseline
+    int     bpp;                        // AA only, 2 or 4
+    
+    const tft_font_range_t *ranges;     // NULL: first / count is the range
+    int     nranges;
+
+} tft_font_t;
+
+extern const tft_font_t tft_font_f16, tft_font_f32, tft_font_f64, tft_font_f128;
+extern const tft_font_t tft_font_sans24, tft_font_sans12aa;
+
+// Font32 / Font64 bounding box packed (tools/fontgen), GFX format
+
+extern const tft_font_t tft_font_f32pk, tft_font_f64pk, tft_font_f128pk;
+
+int     tft_font_register(const tft_font_t *font);
+int     tft_font_set_fallback(int id, int fallback);
+const   tft_font_t *tft_font_get(int id);
+const   tft_font_t *tft_font_by_size(int size);
+
 // EOF
 
 
@@ -0,0 +1,246 @@
+//////////////////////////////////////////////////////////////////////////
+// Glyph cache. Fixed entry pool, chained hash, doubly linked LRU list.
+// Only the cell pixels come from the heap, charged against the budget.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_gcache.h"
+
+#define NIL     (-1)
+
+typedef struct _gcache_entry
+
+{
+    uint32_t key;               // font id << 24 | glyph index
+    uint32_t colors;            // fg << 16 | bg
+    int16_t  ww, hh;
+    uint16_t *pix;
+    int16_t  prev, next;        // LRU, head is most recent
+    int16_t  hnext;             // Hash chain
+
+} gcache_entry;
+
+int  gcache_enabled = false;
+
+static gcache_entry entries[TFT_GCACHE_ENTRIES];
+static int16_t buckets[TFT_GCACHE_BUCKETS];
+static int16_t lru_head = NIL, lru_tail = NIL, free_head = NIL;
+
+static tft_gcache_stats_t stats;
+
+static int  hash_key(uint32_t key, uint32_t colors)
+
+{
+    uint32_t hh = key * 2654435761U ^ colors * 40503U;
+    return (hh >> 16) & (TFT_GCACHE_BUCKETS - 1);
+}
+
+static void lru_unlink(int idx)
+
+{
+    gcache_entry *ee = &entries[idx];
+
+    if(ee->prev != NIL) entries[ee->prev].next = ee->next;
+    else                lru_head = ee->next;
+    if(ee->next != NIL) entries[ee->next].prev = ee->prev;
+    else                lru_tail = ee->prev;
+}
+
+static void lru_push(int idx)
+
+{
+    gcache_entry *ee = &entries[idx];
+
+    ee->prev = NIL; ee->next = lru_head;
+    if(lru_head != NIL) entries[lru_head].prev = idx;
+    lru_head = idx;
+    if(lru_tail == NIL) lru_tail = idx;
+}
+
+// Drop the least recently used cell
+
+static void evict_tail()
+
+{
+    int idx = lru_tail;
+    if(idx == NIL)
+        return;
+
+    gcache_entry *ee = &entries[idx];
+    int16_t *link = &buckets[hash_key(ee->key, ee->colors)];
+    while(*link != idx)
+        link = &entries[*link].hnext;
+    *link = ee->hnext;
+
+    lru_unlink(idx);
+    stats.used -= ee->ww * ee->hh * sizeof(uint16_t);
+    stats.entries--;
+    heap_caps_free(ee->pix);
+    ee->pix = NULL;
+
+    ee->next = free_head; free_head = idx;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Set the byte budget and start caching. Zero budget turns it off.
+
+int  tft_gcache_init(int budget)
+
+{
+    tft_gcache_clear();
+    stats.budget = budget;
+    gcache_enabled = budget > 0;
+    return 0;
+}
+
+void tft_gcache_clear()
+
+{
+    while(lru_tail != NIL)
+        evict_tail();
+
+    for(int loop = 0; loop < TFT_GCACHE_BUCKETS; loop++)
+        buckets[loop] = NIL;
+
+    free_head = NIL;
+    for(int loop = TFT_GCACHE_ENTRIES - 1; loop >= 0; loop--)
+        {
+        entries[loop].pix = NULL;
+        entries[loop].next = free_head;
+        free_head = loop;
+        }
+    stats.used = 0; stats.entries = 0;
+}
+
+static int  lookup(uint32_t key, uint32_t colors)
+
+{
+    int idx = buckets[hash_key(key, colors)];
+    while(idx != NIL)
+        {
+        if(entries[idx].key == key && entries[idx].colors == colors)
+            return idx;
+        idx = entries[idx].hnext;
+        }
+    return NIL;
+}
+
+// Render the cell and link it in
+
+static int  insert(const tft_font_t *font, int idx, uint32_t key, uint32_t colors)
+
+{
+    int ww, hh;
+    font_glyph_extent(font, idx, &ww, &hh);
+
+    int bytes = ww * hh * sizeof(uint16_t);
+    if(ww <= 0 || hh <= 0 || bytes > stats.budget)
+        return NIL;
+
+    while(stats.used + bytes > stats.budget || free_head == NIL)
+        {
+        evict_tail();
+        stats.evictions++;
+        }
+
+    uint16_t *pix = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if(pix == NULL)
+        return NIL;
+
+    font_glyph_render(font, idx, pix, ww, colors >> 16, colors & 0xffff);
+
+    int slot = free_head;
+    gcache_entry *ee = &entries[slot];
+    free_head = ee->next;
+
+    ee->key = key; ee->colors = colors;
+    ee->ww = ww; ee->hh = hh; ee->pix = pix;
+
+    int bucket = hash_key(key, colors);
+    ee->hnext = buckets[bucket]; buckets[bucket] = slot;
+    lru_push(slot);
+
+    stats.used += bytes; stats.entries++;
+    return slot;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int  tft_gcache_draw(const tft_font_t *font, int glyph, int xx, int yy,
+                            uint16_t fg, uint16_t bg)
+
+{
+    uint32_t key = ((uint32_t)font->id << 24) | glyph, colors = ((uint32_t)fg << 16) | bg;
+
+    int idx = lookup(key, colors);
+    if(idx != NIL)
+        {
+        stats.hits++;
+        if(idx != lru_head)
+            {
+            lru_unlink(idx); lru_push(idx);
+            }
+        }
+    else
+        {
+        stats.misses++;
+        idx = insert(font, glyph, key, colors);
+        if(idx == NIL)
+            {
+            stats.rejects++;
+            return -1;
+            }
+        }
+
+    // One row copy per glyph row, clipped to the screen
+    gcache_entry *ee = &entries[idx];
+    int left = MAX(0, -xx), right = MIN(ee->ww, SCREEN_WIDTH - xx);
+    if(right > left)
+        {
+        for(int loop = MAX(0, -yy); loop < ee->hh; loop++)
+            {
+            if(yy + loop >= SCREEN_HEIGHT)
+                break;
+            memcpy(TFT_FB_ROW(yy + loop) + xx + left, ee->pix + loop * ee->ww + left,
+                                            (right - left) * sizeof(uint16_t));
+            }
+        }
+    return ee->ww;
+}
+
+void tft_gcache_get_stats(tft_gcache_stats_t *st)
+
+{
+    *st = stats;
+}
+
+void tft_gcache_reset_stats()
+
+{
+    stats.hits = stats.misses = stats.evictions = stats.rejects = 0;
+}
+
+void tft_gcache_print_stats()
+
+{
+    uint32_t total = stats.hits + stats.misses;
+    printf("Glyph cache: %s hits %u misses %u (%u%%) evict %u reject %u "
+                "used %d/%d bytes in %d cells\n",
+                    gcache_enabled ? "on" : "off",
+                        (unsigned)stats.hits, (unsigned)stats.misses,
+                            (unsigned)(total ? (stats.hits * 100) / total : 0),
+                                (unsigned)stats.evictions, (unsigned)stats.rejects,
+                                    stats.used, stats.budget, stats.entries);
+}
+
+// EOF
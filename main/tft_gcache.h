@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////////////////////////
+// Glyph cache. Keeps rendered RGB565 glyph cells in internal RAM,
+// keyed by font, glyph, foreground and background. A hit is one
+// row copy per glyph row. Least recently used cells are dropped when
+// the byte budget runs out. Include tft_fonts.h first.
+
+#define TFT_GCACHE_ENTRIES  128         // Max cached cells
+#define TFT_GCACHE_BUCKETS  64          // Hash buckets, power of 2
+
+#ifndef CONFIG_TFT_GLYPH_CACHE_SIZE
+#define CONFIG_TFT_GLYPH_CACHE_SIZE 16384
+#endif
+
+typedef struct _tft_gcache_stats_t
+
+{
+    uint32_t hits, misses, evictions, rejects;
+    int used, budget, entries;
+
+} tft_gcache_stats_t;
+
+extern int  gcache_enabled;         // Flip to bypass the cache
+
+int  tft_gcache_init(int budget);
+void tft_gcache_clear();
+
+// Draw glyph (index in font) from cache, render and add on miss. 
+// Returns the advance, or -1 if the cell cannot be cached (caller 
+// draws directly)
+
+int  tft_gcache_draw(const tft_font_t *font, int glyph, int xx, int yy,
+                            uint16_t fg, uint16_t bg);
+
+void tft_gcache_get_stats(tft_gcache_stats_t *st);
+void tft_gcache_print_stats();
+void tft_gcache_reset_stats();
+
+// EOF
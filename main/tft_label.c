@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////
+// Retained text labels, cell diff redraw
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_blend.h"
+#include "tft_layout.h"
+#include "tft_label.h"
+
+// New layout, compared against the label. One UI task draws.
+
+static tft_layout_t lay;
+
+void tft_label_init(tft_label_t *lab, const tft_font_t *font, int xx, int yy,
+                        int ww, int flags, uint16_t color, uint16_t back)
+
+{
+    memset(lab, 0, sizeof(*lab));
+    lab->font = font;
+    lab->xx = xx; lab->yy = yy; lab->ww = ww;
+    lab->flags = flags & ~TFT_LAYOUT_WRAP;
+    lab->color = color; lab->back = back;
+}
+
+void tft_label_color(tft_label_t *lab, uint16_t color, uint16_t back)
+
+{
+    if(lab->color != color || lab->back != back)
+        lab->valid = false;
+    lab->color = color; lab->back = back;
+}
+
+void tft_label_invalidate(tft_label_t *lab)
+
+{
+    lab->valid = false;
+}
+
+// Background over a vacated stretch, sent. Returns pixels.
+
+static int  clear_run(spi_device_handle_t spi, tft_label_t *lab, int xx, int ww)
+
+{
+    int hh = lay.line_hh;
+
+    if(xx < 0) { ww += xx; xx = 0; }
+    if(xx + ww > SCREEN_WIDTH) ww = SCREEN_WIDTH - xx;
+    if(ww <= 0)
+        return 0;
+
+    for(int loop = 0; loop < hh; loop++)
+        {
+        if(lab->yy + loop >= 0 && lab->yy + loop < SCREEN_HEIGHT)
+            tft_span_fill(TFT_FB_ROW(lab->yy + loop) + xx, ww, lab->back);
+        }
+    tft_flush_rect(spi, xx, lab->yy, ww, hh);
+    return ww * hh;
+}
+
+// Glyphs first .. last - 1 changed, cells are contiguous
+
+static int  draw_run(spi_device_handle_t spi, tft_label_t *lab, int first,
+                            int last, int end)
+
+{
+    for(int loop = first; loop < last; loop++)
+        {
+        tft_glyph_pos_t *gp = &lay.glyphs[loop];
+        font_glyph_draw(gp->font, gp->idx, gp->xx, gp->yy, lab->color, lab->back);
+        }
+    int xx = lay.glyphs[first].xx;
+    tft_flush_rect(spi, xx, lab->yy, end - xx, lay.line_hh);
+    return (end - xx) * lay.line_hh;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int  tft_label_set(spi_device_handle_t spi, tft_label_t *lab, const uint8_t *sss)
+
+{
+    int sent = 0;
+
+    tft_layout(&lay, lab->font, sss, lab->xx, lab->yy, lab->ww, 0, lab->flags);
+
+    int start = lay.lines ? lay.line[0].xx : lab->xx;
+    int end = lay.lines ? start + lay.line[0].ww : lab->xx;
+
+    if(!lab->valid || lay.count > TFT_LABEL_MAX_GLYPHS)
+        {
+        tft_layout_draw(spi, &lay, lab->color, lab->back);
+        sent = lab->ww * lay.hh;
+        }
+    else
+        {
+        // Runs of cells that differ from last time
+        int first = -1;
+        for(int loop = 0; loop <= lay.count; loop++)
+            {
+            int dirty = false;
+            if(loop < lay.count)
+                {
+                tft_glyph_pos_t *gp = &lay.glyphs[loop];
+                tft_label_cell_t *cc = &lab->cells[loop];
+                dirty = loop >= lab->count || cc->xx != gp->xx ||
+                            cc->idx != gp->idx || cc->font != gp->font->id;
+                }
+            if(dirty)
+                {
+                if(first < 0)
+                    first = loop;
+                continue;
+                }
+            if(first >= 0)
+                {
+                int run_end = loop < lay.count ? lay.glyphs[loop].xx : end;
+                sent += draw_run(spi, lab, first, loop, run_end);
+                first = -1;
+                }
+            }
+        // Old text outside the new extent
+        if(lab->start < start)
+            sent += clear_run(spi, lab, lab->start, MIN(lab->end, start) - lab->start);
+        if(lab->end > end)
+            {
+            int from = MAX(end, lab->start);
+            sent += clear_run(spi, lab, from, lab->end - from);
+            }
+        }
+    // Remember what is on screen now
+    lab->valid = lay.count <= TFT_LABEL_MAX_GLYPHS;
+    lab->count = MIN(lay.count, TFT_LABEL_MAX_GLYPHS);
+    for(int loop = 0; loop < lab->count; loop++)
+        {
+        lab->cells[loop].xx = lay.glyphs[loop].xx;
+        lab->cells[loop].idx = lay.glyphs[loop].idx;
+        lab->cells[loop].font = lay.glyphs[loop].font->id;
+        }
+    lab->start = start; lab->end = end;
+
+    return sent;
+}
+
+// EOF
@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////////////////////////
+// Retained text labels. A label keeps its font, box, colors and the
+// glyph cells it drew last. Setting new text lays it out, compares
+// cell by cell, and renders and sends only the runs of cells that
+// changed, plus any part of the old text the new one no longer
+// covers. (include tft_fonts.h and tft_layout.h first)
+
+#define TFT_LABEL_MAX_GLYPHS    64
+
+typedef struct _tft_label_cell_t
+
+{
+    int16_t xx;                         // Cell left, screen
+    int16_t idx;                        // Glyph in font
+    uint8_t font;                       // Font ID
+
+} tft_label_cell_t;
+
+typedef struct _tft_label_t
+
+{
+    const tft_font_t *font;
+    int16_t xx, yy, ww;                 // Field, one line high
+    int16_t flags;                      // TFT_ALIGN_*, TFT_LAYOUT_ELLIPSIS
+    uint16_t color, back;
+    int16_t valid;                      // Screen matches the cells
+    int16_t count;
+    int16_t start, end;                 // Text extent on screen
+    tft_label_cell_t cells[TFT_LABEL_MAX_GLYPHS];
+
+} tft_label_t;
+
+void tft_label_init(tft_label_t *lab, const tft_font_t *font, int xx, int yy,
+                        int ww, int flags, uint16_t color, uint16_t back);
+
+// Redraw the changed cells. Returns the number of pixels sent.
+
+int  tft_label_set(spi_device_handle_t spi, tft_label_t *lab, const uint8_t *sss);
+
+// Next set draws the whole field (color change, screen cleared)
+
+void tft_label_color(tft_label_t *lab, uint16_t color, uint16_t back);
+void tft_label_invalidate(tft_label_t *lab);
+
+// EOF
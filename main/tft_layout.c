@@ -0,0 +1,296 @@
+//////////////////////////////////////////////////////////////////////////
+// Text layout, measurement cache
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_blend.h"
+#include "tft_layout.h"
+
+typedef struct _measure_entry
+
+{
+    uint32_t hash;
+    const tft_font_t *font;             // NULL: empty
+    int      width;
+
+} measure_entry;
+
+static measure_entry measure[TFT_MEASURE_ENTRIES];
+
+// FNV-1a over sss up to end
+
+static uint32_t str_hash(const uint8_t *sss, const uint8_t *end)
+
+{
+    uint32_t hh = 2166136261U;
+
+    for(; sss < end; sss++)
+        hh = (hh ^ *sss) * 16777619U;
+    return hh;
+}
+
+// Width of the glyphs from sss up to end. Labels, columns and the
+// words a wrapped box breaks at come back again and again, the glyph
+// walk only runs on a miss.
+
+static int  span_width(const tft_font_t *font, const uint8_t *sss,
+                                const uint8_t *end)
+
+{
+    uint32_t hash = str_hash(sss, end);
+    measure_entry *ee = &measure[hash & (TFT_MEASURE_ENTRIES - 1)];
+    if(ee->font == font && ee->hash == hash)
+        return ee->width;
+
+    int pos = 0;
+    while(sss < end)
+        {
+        int idx, www, hhh;
+        uint32_t code = tft_utf8_next(&sss);
+        const tft_font_t *gfont = font_glyph_find(font, code, &idx);
+        pos += font_glyph_extent(gfont, idx, &www, &hhh);
+        }
+    ee->font = font; ee->hash = hash; ee->width = pos;
+    return pos;
+}
+
+// Word from sss to the next space, newline or end
+
+static int  word_width(const tft_font_t *font, const uint8_t *sss)
+
+{
+    const uint8_t *end = sss;
+
+    while(*end != '\0' && *end != ' ' && *end != '\n')
+        end++;
+    return end == sss ? 0 : span_width(font, sss, end);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Width of the string
+
+int tft_text_width(const tft_font_t *font, const uint8_t *sss)
+
+{
+    if(font == NULL)
+        return 0;
+    return span_width(font, sss, sss + strlen((const char *)sss));
+}
+
+void tft_measure_clear()
+
+{
+    memset(measure, 0, sizeof(measure));
+}
+
+// Background into screen memory, clipped
+
+static void fill_back(int xx, int yy, int ww, int hh, uint16_t back)
+
+{
+    if(xx < 0) { ww += xx; xx = 0; }
+    if(yy < 0) { hh += yy; yy = 0; }
+    if(xx + ww > SCREEN_WIDTH)  ww = SCREEN_WIDTH - xx;
+    if(yy + hh > SCREEN_HEIGHT) hh = SCREEN_HEIGHT - yy;
+
+    for(int loop = 0; loop < hh; loop++)
+        tft_span_fill(TFT_FB_ROW(yy + loop) + xx, ww, back);
+}
+
+static int  place(tft_layout_t *lay, const tft_font_t *font, int idx, int pos)
+
+{
+    int www, hhh;
+    tft_glyph_pos_t *gp = &lay->glyphs[lay->count++];
+
+    gp->font = font; gp->idx = idx; gp->xx = pos;
+    return font_glyph_extent(font, idx, &www, &hhh);
+}
+
+// Cut the line back until "..." fits, then add it. Returns the width.
+
+static int  add_ellipsis(tft_layout_t *lay, const tft_font_t *font, int first,
+                                int pos, int ww)
+
+{
+    int idx, www, hhh;
+    const tft_font_t *dfont = font_glyph_find(font, '.', &idx);
+    int dot = font_glyph_extent(dfont, idx, &www, &hhh);
+
+    while(lay->count > first && pos + 3 * dot > ww)
+        pos = lay->glyphs[--lay->count].xx;
+
+    // No space before the dots
+    int sidx;
+    const tft_font_t *sfont = font_glyph_find(font, ' ', &sidx);
+    while(lay->count > first && lay->glyphs[lay->count - 1].font == sfont &&
+                                lay->glyphs[lay->count - 1].idx == sidx)
+        pos = lay->glyphs[--lay->count].xx;
+
+    for(int loop = 0; loop < 3; loop++)
+        {
+        if(pos + dot > ww || lay->count >= TFT_LAYOUT_MAX_GLYPHS)
+            break;
+        pos += place(lay, dfont, idx, pos);
+        }
+    return pos;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Lay out a string in the box. Glyph x is kept relative while a line
+// is filled, made absolute once the line width (alignment) is known.
+
+int tft_layout(tft_layout_t *lay, const tft_font_t *font, const uint8_t *sss,
+                        int xx, int yy, int ww, int hh, int flags)
+
+{
+    lay->xx = xx; lay->yy = yy; lay->ww = ww;
+    lay->count = lay->lines = 0;
+    lay->line_hh = font ? font->height * font->scale : 0;
+    lay->hh = hh > 0 ? hh : lay->line_hh;
+
+    if(font == NULL || ww <= 0)
+        return 0;
+
+    int maxlines = MIN(lay->hh / lay->line_hh, TFT_LAYOUT_MAX_LINES);
+    if(maxlines < 1 || !(flags & TFT_LAYOUT_WRAP))
+        maxlines = 1;
+
+    const uint8_t *ptr = sss;
+    while(*ptr != '\0' && lay->lines < maxlines)
+        {
+        tft_layout_line_t *line = &lay->line[lay->lines];
+        int last = lay->lines == maxlines - 1, more = false;
+        int pos = 0, brk = -1, brk_pos = 0;
+        const uint8_t *brk_ptr = NULL;
+
+        line->first = lay->count;
+        while(*ptr != '\0')
+            {
+            // Word start: break before a word that will not fit, rather
+            // than place it and back up to the space
+            if(!last && brk > line->first && brk == lay->count - 1 &&
+                            pos + word_width(font, ptr) > ww)
+                {
+                lay->count = brk; pos = brk_pos;
+                break;
+                }
+
+            const uint8_t *prev = ptr;
+            uint32_t code = tft_utf8_next(&ptr);
+            if(code == '\n' && !last)
+                break;
+
+            int idx, www, hhh;
+            const tft_font_t *gfont = font_glyph_find(font, code, &idx);
+            int adv = font_glyph_extent(gfont, idx, &www, &hhh);
+
+            if(pos + adv > ww || lay->count >= TFT_LAYOUT_MAX_GLYPHS)
+                {
+                if(!last && lay->count < TFT_LAYOUT_MAX_GLYPHS)
+                    {
+                    // Back to the last space, or break the word
+                    if(brk > line->first)
+                        {
+                        lay->count = brk; pos = brk_pos; ptr = brk_ptr;
+                        }
+                    else if(lay->count > line->first)
+                        ptr = prev;
+                    else
+                        pos += place(lay, gfont, idx, pos);
+                    break;
+                    }
+                more = true;
+                break;
+                }
+            if(code == ' ')
+                {
+                brk = lay->count; brk_pos = pos; brk_ptr = ptr;
+                }
+            pos += place(lay, gfont, idx, pos);
+            }
+        if(more && (flags & TFT_LAYOUT_ELLIPSIS))
+            pos = add_ellipsis(lay, font, line->first, pos, ww);
+
+        // Align, then to screen coordinates
+        int align = flags & TFT_ALIGN_MASK, offs = 0;
+        if(align == TFT_ALIGN_RIGHT)
+            offs = ww - pos;
+        else if(align == TFT_ALIGN_CENTER)
+            offs = (ww - pos) / 2;
+
+        line->count = lay->count - line->first;
+        line->xx = xx + offs; line->ww = pos;
+        for(int loop = line->first; loop < lay->count; loop++)
+            {
+            lay->glyphs[loop].xx += line->xx;
+            lay->glyphs[loop].yy = yy + lay->lines * lay->line_hh;
+            }
+        lay->lines++;
+        if(more)
+            break;
+        }
+    return lay->count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Glyph cells and the gaps around them, every box pixel written once
+
+int tft_layout_render(const tft_layout_t *lay, uint16_t color, uint16_t back)
+
+{
+    for(int loop = 0; loop < lay->lines; loop++)
+        {
+        const tft_layout_line_t *line = &lay->line[loop];
+        int ly = lay->yy + loop * lay->line_hh;
+        int end = line->xx + line->ww;
+
+        fill_back(lay->xx, ly, line->xx - lay->xx, lay->line_hh, back);
+        for(int loop2 = line->first; loop2 < line->first + line->count; loop2++)
+            {
+            const tft_glyph_pos_t *gp = &lay->glyphs[loop2];
+            font_glyph_draw(gp->font, gp->idx, gp->xx, gp->yy, color, back);
+            }
+        fill_back(end, ly, lay->xx + lay->ww - end, lay->line_hh, back);
+        }
+    int used = lay->lines * lay->line_hh;
+    fill_back(lay->xx, lay->yy + used, lay->ww, lay->hh - used, back);
+
+    return lay->count;
+}
+
+int tft_layout_draw(spi_device_handle_t spi, const tft_layout_t *lay,
+                        uint16_t color, uint16_t back)
+
+{
+    tft_layout_render(lay, color, back);
+    return tft_flush_rect(spi, lay->xx, lay->yy, lay->ww, lay->hh);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Returns the end x of the text
+
+int tft_text_field(spi_device_handle_t spi, const tft_font_t *font,
+                        const uint8_t *sss, int xx, int yy, int ww, int flags,
+                            uint16_t color)
+
+{
+    static tft_layout_t lay;
+
+    tft_layout(&lay, font, sss, xx, yy, ww, 0, flags & ~TFT_LAYOUT_WRAP);
+    tft_layout_draw(spi, &lay, color, fontback);
+
+    return lay.lines ? lay.line[0].xx + lay.line[0].ww : xx;
+}
+
+// EOF
@@ -0,0 +1,71 @@
+//////////////////////////////////////////////////////////////////////////
+// Text layout. Lays a UTF-8 string out in a box: alignment, ellipsis
+// or word wrap. The result is a glyph position list that
+// tft_layout_render() paints directly, background included, so a
+// field redraw needs no clearing pass. (include tft_fonts.h first)
+
+#define TFT_ALIGN_LEFT          0
+#define TFT_ALIGN_CENTER        1
+#define TFT_ALIGN_RIGHT         2
+#define TFT_ALIGN_MASK          3
+
+#define TFT_LAYOUT_ELLIPSIS     4       // Cut with "..." if too long
+#define TFT_LAYOUT_WRAP         8       // Break lines at spaces
+
+#define TFT_LAYOUT_MAX_GLYPHS   128
+#define TFT_LAYOUT_MAX_LINES    8
+
+#define TFT_MEASURE_ENTRIES     64      // Width cache, power of 2
+
+typedef struct _tft_glyph_pos_t
+
+{
+    const tft_font_t *font;             // Fallbacks may differ
+    int16_t idx;                        // Glyph in font
+    int16_t xx, yy;                     // Cell top left, screen
+
+} tft_glyph_pos_t;
+
+typedef struct _tft_layout_line_t
+
+{
+    int16_t first, count;               // Glyphs on this line
+    int16_t xx, ww;                     // Aligned extent
+
+} tft_layout_line_t;
+
+typedef struct _tft_layout_t
+
+{
+    int     xx, yy, ww, hh;             // Box
+    int     line_hh;
+    int     count, lines;
+    tft_glyph_pos_t   glyphs[TFT_LAYOUT_MAX_GLYPHS];
+    tft_layout_line_t line[TFT_LAYOUT_MAX_LINES];
+
+} tft_layout_t;
+
+// String width, cached per (font, string hash)
+
+int tft_text_width(const tft_font_t *font, const uint8_t *sss);
+void tft_measure_clear();
+
+// Lay out into the box. Height 0 is one line. Returns glyphs placed.
+
+int tft_layout(tft_layout_t *lay, const tft_font_t *font, const uint8_t *sss,
+                        int xx, int yy, int ww, int hh, int flags);
+
+// Paint glyphs and the rest of the box in back, into screen memory.
+// tft_layout_draw() also sends the box.
+
+int tft_layout_render(const tft_layout_t *lay, uint16_t color, uint16_t back);
+int tft_layout_draw(spi_device_handle_t spi, const tft_layout_t *lay,
+                        uint16_t color, uint16_t back);
+
+// One line field: lay out, render, send. Background is fontback.
+
+int tft_text_field(spi_device_handle_t spi, const tft_font_t *font,
+                        const uint8_t *sss, int xx, int yy, int ww, int flags,
+                            uint16_t color);
+
+// EOF
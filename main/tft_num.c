@@ -0,0 +1,262 @@
+//////////////////////////////////////////////////////////////////////////
+// Numeric fields, pre-rendered digit cells
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_blend.h"
+#include "tft_num.h"
+
+#define CELL_MINUS  10
+#define CELL_BLANK  11
+#define CELL_COUNT  12
+
+static const char cell_chars[CELL_COUNT] = "0123456789- ";
+
+typedef struct _num_set
+
+{
+    const tft_font_t *font;             // NULL: unused
+    uint32_t colors;                    // fg << 16 | bg
+    int16_t  ww, hh;
+    uint16_t *pix;                      // CELL_COUNT cells, ww x hh each
+
+} num_set;
+
+static num_set sets[TFT_NUM_SETS];
+static int  set_next = 0;
+
+// One width for all cells: the widest of them
+
+static void cell_extent(const tft_font_t *font, int *ww, int *hh)
+
+{
+    *ww = *hh = 0;
+    for(int loop = 0; loop < CELL_COUNT; loop++)
+        {
+        int www, hhh;
+        font_char_extent(font, cell_chars[loop], &www, &hhh);
+        *ww = MAX(*ww, www); *hh = MAX(*hh, hhh);
+        }
+}
+
+// Cells for the font and color pair, rendered on first use. Glyphs
+// narrower than the cell are centered.
+
+static num_set *get_set(const tft_font_t *font, uint16_t fg, uint16_t bg)
+
+{
+    uint32_t colors = ((uint32_t)fg << 16) | bg;
+
+    for(int loop = 0; loop < TFT_NUM_SETS; loop++)
+        {
+        if(sets[loop].font == font && sets[loop].colors == colors)
+            return &sets[loop];
+        }
+    num_set *ss = &sets[set_next];
+    set_next = (set_next + 1) % TFT_NUM_SETS;
+
+    heap_caps_free(ss->pix);
+    memset(ss, 0, sizeof(*ss));
+
+    int ww, hh;
+    cell_extent(font, &ww, &hh);
+    if(ww <= 0 || hh <= 0)
+        return NULL;
+
+    int size = ww * hh;
+    ss->pix = heap_caps_malloc(CELL_COUNT * size * sizeof(uint16_t),
+                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if(ss->pix == NULL)
+        return NULL;
+
+    tft_span_fill(ss->pix, CELL_COUNT * size, bg);
+    for(int loop = 0; loop < CELL_COUNT; loop++)
+        {
+        int www, hhh;
+        font_char_extent(font, cell_chars[loop], &www, &hhh);
+        font_char_render(font, cell_chars[loop], ss->pix + loop * size +
+                                            (ww - www) / 2, ww, fg, bg);
+        }
+    ss->font = font; ss->colors = colors;
+    ss->ww = ww; ss->hh = hh;
+    return ss;
+}
+
+// Copy one cell into screen memory, clipped
+
+static void put_cell(const num_set *ss, int cell, int xx, int yy)
+
+{
+    const uint16_t *src = ss->pix + cell * ss->ww * ss->hh;
+    int left = MAX(0, -xx), right = MIN(ss->ww, SCREEN_WIDTH - xx);
+
+    if(right <= left)
+        return;
+    for(int loop = MAX(0, -yy); loop < ss->hh; loop++)
+        {
+        if(yy + loop >= SCREEN_HEIGHT)
+            break;
+        memcpy(TFT_FB_ROW(yy + loop) + xx + left, src + loop * ss->ww + left,
+                                        (right - left) * sizeof(uint16_t));
+        }
+}
+
+// Prefix or unit text, sent. Returns pixels.
+
+static int  draw_static(spi_device_handle_t spi, tft_num_t *num,
+                            const char *text, int xx)
+
+{
+    const uint8_t *ptr = (const uint8_t *)text;
+    int pos = xx;
+
+    if(text == NULL)
+        return 0;
+    while(*ptr != '\0')
+        {
+        int idx;
+        const tft_font_t *gfont = font_glyph_find(num->font, tft_utf8_next(&ptr), &idx);
+        pos += font_glyph_draw(gfont, idx, pos, num->yy, num->color, num->back);
+        }
+    if(pos > xx)
+        tft_flush_rect(spi, xx, num->yy, pos - xx, num->hh);
+    return (pos - xx) * num->hh;
+}
+
+// Right aligned, blank padded
+
+static void to_cells(int value, int8_t *cc, int cells)
+
+{
+    unsigned int mag = value < 0 ? -(unsigned int)value : (unsigned int)value;
+    int pos = cells;
+
+    while(pos > 0)
+        {
+        cc[--pos] = mag % 10;
+        mag /= 10;
+        if(mag == 0)
+            break;
+        }
+
+    if(value < 0 && pos > 0)
+        cc[--pos] = CELL_MINUS;
+    else if(value < 0)
+        mag = 1;
+
+    if(mag)
+        memset(cc, CELL_MINUS, cells);
+    else
+        memset(cc, CELL_BLANK, pos);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void tft_num_init(tft_num_t *num, const tft_font_t *font, int xx, int yy,
+                        int cells, const char *prefix, const char *unit,
+                            uint16_t color, uint16_t back)
+
+{
+    int ww, hh, hhh, pre = 0, post = 0;
+
+    // Field height is the tallest of cells, prefix and unit
+    memset(num, 0, sizeof(*num));
+    cell_extent(font, &ww, &hh);
+    if(prefix)
+        {
+        draw_text_extent(font, (uint8_t *)prefix, &pre, &hhh);
+        hh = MAX(hh, hhh);
+        }
+    if(unit)
+        {
+        draw_text_extent(font, (uint8_t *)unit, &post, &hhh);
+        hh = MAX(hh, hhh);
+        }
+
+    num->font = font;
+    num->prefix = prefix; num->unit = unit;
+    num->cells = MIN(MAX(cells, 1), TFT_NUM_MAX_CELLS);
+    num->cell_ww = ww;
+    num->xx = xx; num->yy = yy;
+    num->cx = xx + pre;
+    num->ww = pre + num->cells * ww + post;
+    num->hh = hh;
+    num->color = color; num->back = back;
+    num->blank = true;
+}
+
+void tft_num_invalidate(tft_num_t *num)
+
+{
+    num->valid = num->blank = false;
+}
+
+int  tft_num_set(spi_device_handle_t spi, tft_num_t *num, int value)
+
+{
+    int8_t cc[TFT_NUM_MAX_CELLS];
+    int sent = 0, first = -1, last = -1;
+
+    num_set *ss = get_set(num->font, num->color, num->back);
+    if(ss == NULL)
+        return 0;
+
+    if(!num->valid)
+        {
+        sent += draw_static(spi, num, num->prefix, num->xx);
+        sent += draw_static(spi, num, num->unit, num->cx + num->cells * ss->ww);
+        memset(num->shown, -1, sizeof(num->shown));
+        }
+    to_cells(value, cc, num->cells);
+
+    for(int loop = 0; loop < num->cells; loop++)
+        {
+        if(cc[loop] == num->shown[loop])
+            continue;
+        put_cell(ss, cc[loop], num->cx + loop * ss->ww, num->yy);
+        num->shown[loop] = cc[loop];
+        if(first < 0)
+            first = loop;
+        last = loop;
+        }
+    if(first >= 0)
+        {
+        int ww = (last - first + 1) * ss->ww;
+        tft_flush_rect(spi, num->cx + first * ss->ww, num->yy, ww, ss->hh);
+        sent += ww * ss->hh;
+        }
+    num->valid = true; num->blank = false;
+    return sent;
+}
+
+int  tft_num_clear(spi_device_handle_t spi, tft_num_t *num)
+
+{
+    int xx = MAX(num->xx, 0), ww = MIN(num->xx + num->ww, SCREEN_WIDTH) - xx;
+
+    if(num->blank)
+        return 0;
+    num->valid = false; num->blank = true;
+    if(ww <= 0)
+        return 0;
+
+    for(int loop = 0; loop < num->hh; loop++)
+        {
+        if(num->yy + loop >= 0 && num->yy + loop < SCREEN_HEIGHT)
+            tft_span_fill(TFT_FB_ROW(num->yy + loop) + xx, ww, num->back);
+        }
+    tft_flush_rect(spi, xx, num->yy, ww, num->hh);
+    return ww * num->hh;
+}
+
+// EOF
@@ -0,0 +1,40 @@
+//////////////////////////////////////////////////////////////////////////
+// Numeric fields. Counters, channel numbers and RSSI values are drawn
+// from pre-rendered cells: the ten digits, minus and blank, all one
+// width, kept per font and color pair. A field is a row of cells with
+// the number right aligned. Setting a value copies in and sends only
+// the cells that changed, no printf, no glyph lookups. The prefix and
+// unit text are static, sent once. (include tft_fonts.h first)
+
+#define TFT_NUM_SETS        4           // Cell sets kept, replaced round robin
+#define TFT_NUM_MAX_CELLS   8
+
+typedef struct _tft_num_t
+
+{
+    const tft_font_t *font;
+    const char *prefix, *unit;          // Static text, NULL for none
+    int16_t xx, yy, ww, hh;             // Whole field, prefix to unit
+    int16_t cx, cells, cell_ww;         // Digit cells
+    uint16_t color, back;
+    int16_t valid;                      // Screen matches shown[]
+    int16_t blank;                      // Field is all background
+    int8_t  shown[TFT_NUM_MAX_CELLS];
+
+} tft_num_t;
+
+void tft_num_init(tft_num_t *num, const tft_font_t *font, int xx, int yy,
+                        int cells, const char *prefix, const char *unit,
+                            uint16_t color, uint16_t back);
+
+// Show the value. Too long for the cells shows all minus signs.
+// Returns the number of pixels sent.
+
+int  tft_num_set(spi_device_handle_t spi, tft_num_t *num, int value);
+
+// Field to background, statics too. Next set draws it all.
+
+int  tft_num_clear(spi_device_handle_t spi, tft_num_t *num);
+void tft_num_invalidate(tft_num_t *num);
+
+// EOF
@@ -0,0 +1,221 @@
+//////////////////////////////////////////////////////////////////////////
+// Scanline polygon filler
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "driver/spi_master.h"
+
+#include "tft_base.h"
+#include "tft_blend.h"
+#include "tft_poly.h"
+
+typedef struct _poly_edge
+
+{
+    int ytop, ybot;         // Scanlines covered: ytop <= y < ybot
+    int xx;                 // 16.16, x at the current scanline center
+    int slope;              // 16.16, dx per scanline
+    int dir;                // +1 downwards, -1 upwards (winding)
+
+} poly_edge;
+
+// Static, so big polygons do not land on the caller's stack
+
+static poly_edge edges[TFT_POLY_MAX_EDGES];
+static poly_edge *active[TFT_POLY_MAX_EDGES];
+
+// Convex if all turns have the same sign and the outline goes
+// down and up only once (a star turns the same way all along)
+
+static int  is_convex(const tft_point_t *pts, int cnt)
+
+{
+    int sign = 0, flips = 0, ydir = 0;
+    for(int loop = 0; loop < cnt; loop++)
+        {
+        const tft_point_t *p0 = &pts[loop];
+        const tft_point_t *p1 = &pts[(loop + 1) % cnt];
+        const tft_point_t *p2 = &pts[(loop + 2) % cnt];
+
+        int dy = p1->yy - p0->yy;
+        if(dy != 0)
+            {
+            if(ydir != 0 && (dy > 0 ? 1 : -1) != ydir)
+                flips++;
+            ydir = dy > 0 ? 1 : -1;
+            }
+        int cross = (p1->xx - p0->xx) * (p2->yy - p1->yy) -
+                        dy * (p2->xx - p1->xx);
+        if(cross == 0)
+            continue;
+        if(sign == 0)
+            sign = cross > 0 ? 1 : -1;
+        else if((cross > 0 ? 1 : -1) != sign)
+            return false;
+        }
+    // The wrap from last to first may flip once more
+    return flips <= 2;
+}
+
+// Fill pixels with centers in [xl, xr), both 16.16
+
+static void fill_span(int yy, int xl, int xr, uint16_t color, uint8_t alpha)
+
+{
+    int x1 = (xl + 0x7fff) >> 16, x2 = (xr + 0x7fff) >> 16;
+
+    if(x1 < 0) x1 = 0;
+    if(x2 > SCREEN_WIDTH) x2 = SCREEN_WIDTH;
+    if(x2 <= x1)
+        return;
+
+    if(alpha == TFT_ALPHA_OPAQUE)
+        tft_span_fill(TFT_FB_ROW(yy) + x1, x2 - x1, color);
+    else
+        tft_span_blend(TFT_FB_ROW(yy) + x1, x2 - x1, color, alpha);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fill a closed polygon. (last point connects to the first)
+
+int tft_polygon(spi_device_handle_t spi, const tft_point_t *pts, int cnt,
+                        int rule, uint16_t color, uint8_t alpha)
+
+{
+    int nedge = 0, nactive = 0, next = 0;
+    int minx = SCREEN_WIDTH, maxx = -1, miny = SCREEN_HEIGHT, maxy = -1;
+
+    if(cnt < 3 || cnt > TFT_POLY_MAX_EDGES)
+        return -1;
+
+    // Build the edge table, horizontal edges contribute nothing
+    for(int loop = 0; loop < cnt; loop++)
+        {
+        const tft_point_t *p0 = &pts[loop], *p1 = &pts[(loop + 1) % cnt];
+
+        minx = MIN(minx, p0->xx); maxx = MAX(maxx, p0->xx);
+        miny = MIN(miny, p0->yy); maxy = MAX(maxy, p0->yy);
+
+        if(p0->yy == p1->yy)
+            continue;
+
+        poly_edge *ee = &edges[nedge++];
+        if(p0->yy < p1->yy)
+            {
+            ee->dir = 1;
+            ee->ytop = p0->yy; ee->ybot = p1->yy;
+            ee->xx = p0->xx << 16;
+            ee->slope = ((p1->xx - p0->xx) << 16) / (p1->yy - p0->yy);
+            }
+        else
+            {
+            ee->dir = -1;
+            ee->ytop = p1->yy; ee->ybot = p0->yy;
+            ee->xx = p1->xx << 16;
+            ee->slope = ((p0->xx - p1->xx) << 16) / (p0->yy - p1->yy);
+            }
+        // Step to the center of the first scanline
+        ee->xx += ee->slope / 2;
+        }
+
+    // Sort by top scanline (insertion, edge counts are small)
+    for(int loop = 1; loop < nedge; loop++)
+        {
+        poly_edge tmp = edges[loop];
+        int loop2 = loop - 1;
+        while(loop2 >= 0 && edges[loop2].ytop > tmp.ytop)
+            {
+            edges[loop2 + 1] = edges[loop2];
+            loop2--;
+            }
+        edges[loop2 + 1] = tmp;
+        }
+
+    int convex = is_convex(pts, cnt);
+    int ystart = MAX(miny, 0), yend = MIN(maxy, SCREEN_HEIGHT);
+
+    for(int yy = miny; yy < yend; yy++)
+        {
+        // Retire finished edges, advance the rest
+        int kept = 0;
+        for(int loop = 0; loop < nactive; loop++)
+            {
+            if(active[loop]->ybot > yy)
+                active[kept++] = active[loop];
+            }
+        nactive = kept;
+
+        while(next < nedge && edges[next].ytop == yy)
+            active[nactive++] = &edges[next++];
+
+        if(yy >= ystart && nactive >= 2)
+            {
+            if(convex)
+                {
+                // Fast path, one span between the extremes
+                int xl = active[0]->xx, xr = active[0]->xx;
+                for(int loop = 1; loop < nactive; loop++)
+                    {
+                    xl = MIN(xl, active[loop]->xx);
+                    xr = MAX(xr, active[loop]->xx);
+                    }
+                fill_span(yy, xl, xr, color, alpha);
+                }
+            else
+                {
+                // Keep active list sorted by x, mostly in order already
+                for(int loop = 1; loop < nactive; loop++)
+                    {
+                    poly_edge *tmp = active[loop];
+                    int loop2 = loop - 1;
+                    while(loop2 >= 0 && active[loop2]->xx > tmp->xx)
+                        {
+                        active[loop2 + 1] = active[loop2];
+                        loop2--;
+                        }
+                    active[loop2 + 1] = tmp;
+                    }
+                if(rule == TFT_FILL_EVENODD)
+                    {
+                    for(int loop = 0; loop + 1 < nactive; loop += 2)
+                        fill_span(yy, active[loop]->xx, active[loop + 1]->xx,
+                                                            color, alpha);
+                    }
+                else
+                    {
+                    int wind = 0;
+                    for(int loop = 0; loop + 1 < nactive; loop++)
+                        {
+                        wind += active[loop]->dir;
+                        if(wind != 0)
+                            fill_span(yy, active[loop]->xx, active[loop + 1]->xx,
+                                                            color, alpha);
+                        }
+                    }
+                }
+            }
+        for(int loop = 0; loop < nactive; loop++)
+            active[loop]->xx += active[loop]->slope;
+        }
+
+    if(spi)
+        return tft_flush_rect(spi, minx, miny, maxx - minx + 1, maxy - miny + 1);
+    return 0;
+}
+
+int tft_triangle(spi_device_handle_t spi, int xx, int yy, int xx2, int yy2,
+                        int xx3, int yy3, uint16_t color)
+
+{
+    tft_point_t pts[3] = { { xx, yy }, { xx2, yy2 }, { xx3, yy3 } };
+
+    return tft_polygon(spi, pts, 3, TFT_FILL_EVENODD, color, TFT_ALPHA_OPAQUE);
+}
+
+// EOF
@@ -0,0 +1,27 @@
+//////////////////////////////////////////////////////////////////////////
+// Scanline polygon fill.
+//
+// Edge table / active edge list, x carried in 16.16 fixed point,
+// pixel centers sampled. (shared edges of adjacent polygons are
+// filled exactly once) Spans go through the span kernels; one
+// bounding box flush at the end. Pass spi as NULL to compose only.
+
+#define TFT_POLY_MAX_EDGES  64
+
+#define TFT_FILL_EVENODD    0
+#define TFT_FILL_NONZERO    1
+
+typedef struct _tft_point_t
+
+{
+    int16_t xx, yy;
+
+} tft_point_t;
+
+int tft_polygon(spi_device_handle_t spi, const tft_point_t *pts, int cnt,
+                        int rule, uint16_t color, uint8_t alpha);
+
+int tft_triangle(spi_device_handle_t spi, int xx, int yy, int xx2, int yy2,
+                        int xx3, int yy3, uint16_t color);
+
+// EOF
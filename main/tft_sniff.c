@@ -45,8 +45,19 @@
 #include "lwip/sockets.h"
 
 #include "esp_wifi.h"
+#include "ap_chan.h"
+#include "ap_table.h"
 #include "wifi.h"
+#include "ap_view.h"
+#include "scan_prof.h"
 #include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_gcache.h"
+#include "tft_layout.h"
+#include "tft_label.h"
+#include "tft_num.h"
+#include "tft_bars.h"
+#include "tft_bench.h"
 #include "utils.h"
 
 #if 0
@@ -63,7 +74,68 @@
 #include "../../../common/v000/wcmesht.h"
 #endif
 
-static char tmp[128] = { 0 }, tmp2[64] = { 0 }, tmp3[64] = { 0 };
+static char tmp[128] = { 0 };
+
+// AP list rows, redrawn by changed glyph cells. Channel and RSSI are
+// numeric fields, only the digits that moved go out.
+
+#define AP_ROWS     10
+
+static tft_label_t ssid_labels[AP_ROWS], auth_labels[AP_ROWS];
+static tft_num_t chan_nums[AP_ROWS], rssi_nums[AP_ROWS];
+static tft_num_t scan_num, next_num;
+static tft_label_t view_label;
+
+#ifndef CONFIG_AP_VIEW_CYCLE_SEC
+#define CONFIG_AP_VIEW_CYCLE_SEC    10
+#endif
+
+// Channel chart, in the list's place. Per channel the power of its
+// own APs and, next to it, the overlap load from N - 4 .. N + 4, with
+// the channel number and AP count under them. Only changed bars and
+// digits are sent.
+
+#define CHART_PITCH     22
+#define CHART_XX        ((SCREEN_WIDTH - AP_CHAN_MAX * CHART_PITCH) / 2)
+#define CHART_YY        34
+#define CHART_HH        140
+#define CHART_LO        -100            // dBm at the bottom
+#define CHART_HI        -20             // dBm at the top
+
+static tft_bars_t power_bars, overlap_bars;
+static tft_num_t chart_chans[AP_CHAN_MAX], chart_counts[AP_CHAN_MAX];
+
+// The views stepped through, each a sort key and a filter, or the chart
+
+typedef struct _app_view_t
+
+{
+    const char *name;
+    int     key;
+    ap_filter_t filt;
+    int     chart;
+
+} app_view_t;
+
+static const app_view_t app_views[] = {
+    { .name = "Strongest",    .key = AP_SORT_RSSI,
+        .filt = { .chan = 0, .auth = -1, .prefix = NULL }, .chart = false },
+    { .name = "By channel",   .key = AP_SORT_CHAN,
+        .filt = { .chan = 0, .auth = -1, .prefix = NULL }, .chart = false },
+    { .name = "By security",  .key = AP_SORT_AUTH,
+        .filt = { .chan = 0, .auth = -1, .prefix = NULL }, .chart = false },
+    { .name = "By name",      .key = AP_SORT_SSID,
+        .filt = { .chan = 0, .auth = -1, .prefix = NULL }, .chart = false },
+    { .name = "Open only",    .key = AP_SORT_RSSI,
+        .filt = { .chan = 0, .auth = WIFI_AUTH_OPEN, .prefix = NULL },
+        .chart = false },
+    { .name = "Channels",     .key = 0,
+        .filt = { .chan = 0, .auth = -1, .prefix = NULL }, .chart = true },
+    };
+
+#define APP_VIEWS   (sizeof(app_views) / sizeof(app_views[0]))
+
+static ap_view_t ap_view;
 
 // Hop count. Lower hop count represents better time. (other than 0)
 //
@@ -175,6 +247,160 @@ char *trans_authmod(int mode)
     return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Draws the newest scan snapshot, at most every RENDER_MS. A frame
+// with the same snapshot generation as the last one skips the sort and
+// the list, only the countdown moves. The snapshot is a private copy,
+// the scan task never waits for drawing.
+
+#define RENDER_MS   100
+
+// The AP list, av NULL empties it
+
+static void render_list(spi_device_handle_t spi, const app_view_t *av)
+
+{
+    const ap_entry_t *ee = NULL;
+    int pos = 0;
+
+    for(int loopc = 0; loopc < AP_ROWS; loopc++)
+        {
+        // Rows past the scan results are emptied
+        tmp[0] = '\0';
+        if(av != NULL && (loopc == 0 || ee != NULL))
+            ee = ap_view_next(&ap_view, av->key, &av->filt, &pos);
+        if(ee != NULL)
+            {
+            snprintf(tmp, sizeof(tmp), "%02d %s",  loopc + 1, ee->ssid);
+            tft_num_set(spi, &chan_nums[loopc], ee->primary);
+            tft_num_set(spi, &rssi_nums[loopc], ee->rssi_shown);
+            tft_label_set(spi, &auth_labels[loopc], 
+                                (uint8_t*)trans_authmod(ee->authmode));
+            }
+        else
+            {
+            tft_num_clear(spi, &chan_nums[loopc]);
+            tft_num_clear(spi, &rssi_nums[loopc]);
+            tft_label_set(spi, &auth_labels[loopc], (uint8_t*)"");
+            }
+        // Only the glyph cells that changed go out, long names get "..."
+        tft_label_set(spi, &ssid_labels[loopc], (uint8_t*)tmp);
+        }
+}
+
+// The channel chart, chans NULL empties it
+
+static void render_chart(spi_device_handle_t spi, const ap_chan_t *chans)
+
+{
+    if(chans == NULL)
+        {
+        tft_bars_clear(spi, &power_bars);
+        tft_bars_clear(spi, &overlap_bars);
+        for(int loopc = 0; loopc < AP_CHAN_MAX; loopc++)
+            {
+            tft_num_clear(spi, &chart_chans[loopc]);
+            tft_num_clear(spi, &chart_counts[loopc]);
+            }
+        return;
+        }
+    for(int loopc = 0; loopc < AP_CHAN_MAX; loopc++)
+        {
+        const ap_chan_stat_t *st = &chans->ch[loopc + 1];
+        tft_bars_set(spi, &power_bars, loopc, ap_chan_dbm(st->power), TFT_GREEN);
+        tft_bars_set(spi, &overlap_bars, loopc, ap_chan_dbm(st->overlap), TFT_BLUE);
+        tft_num_set(spi, &chart_chans[loopc], loopc + 1);
+        tft_num_set(spi, &chart_counts[loopc], st->count);
+        }
+}
+
+static void render_snap(spi_device_handle_t spi, const app_view_t *av,
+                            const app_view_t *prev)
+
+{
+    // The line stays up, only the count digits change
+    tft_num_set(spi, &scan_num, ap_view.snap->sweeps % 100);
+    tft_label_set(spi, &view_label, (uint8_t*)av->name);
+
+    // The list and the chart share the area, the one going away empties it
+    if(prev != NULL && prev->chart != av->chart)
+        {
+        if(prev->chart)
+            render_chart(spi, NULL);
+        else
+            render_list(spi, NULL);
+        }
+    if(av->chart)
+        render_chart(spi, &ap_view.snap->chans);
+    else
+        render_list(spi, av);
+}
+
+static void render_task(void *parm)
+
+{
+    spi_device_handle_t spi = (spi_device_handle_t)parm;
+    TickType_t period = RENDER_MS / portTICK_PERIOD_MS;
+    TickType_t switched = xTaskGetTickCount(), next_at = switched;
+    int curr = 0, prev = 0;
+    uint32_t have = 0;
+
+    // Two copies: a read that fails leaves the one on screen whole
+    wifi_snap_t *snap = heap_caps_malloc(sizeof(wifi_snap_t), 
+                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    wifi_snap_t *spare = heap_caps_malloc(sizeof(wifi_snap_t), 
+                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if(snap == NULL || spare == NULL)
+        {
+        ESP_LOGI(TAG, "No memory for the render snapshot.\n");
+        heap_caps_free(snap);
+        heap_caps_free(spare);
+        vTaskDelete(NULL);
+        return;
+        }
+    ap_view_init(&ap_view);
+
+    while(true)
+        {
+        TickType_t start = xTaskGetTickCount();
+
+        // Same generation, nothing to sort or draw
+        int fresh = wcwifi_snap_gen() != have && wcwifi_snap_read(&snap, &spare);
+        if(fresh)
+            {
+            have = snap->gen;
+            // All orders follow every snapshot, a switch is only a redraw
+            ap_view_update(&ap_view, snap);
+            }
+        if(have && CONFIG_AP_VIEW_CYCLE_SEC && start - switched >= 
+                    CONFIG_AP_VIEW_CYCLE_SEC * 1000 / portTICK_PERIOD_MS)
+            {
+            curr = (curr + 1) % APP_VIEWS;
+            switched = start;
+            }
+        if(fresh || (have && curr != prev))
+            {
+            render_snap(spi, &app_views[curr], &app_views[prev]);
+            prev = curr;
+            }
+        if(fresh && snap->done)
+            {
+            next_at = start + snap->idle_ms / portTICK_PERIOD_MS;
+            printf("%d ", get_mem_usage()); fflush(stdout);
+            if(snap->sweeps % 10 == 0)
+                scan_prof_report();
+            }
+
+        // Long idle in a quiet place, the countdown keeps it live
+        int left = (int)(next_at - start) * portTICK_PERIOD_MS;
+        tft_num_set(spi, &next_num, left > 0 ? (left + 999) / 1000 : 0);
+
+        TickType_t spent = xTaskGetTickCount() - start;
+        if(spent < period)
+            vTaskDelay(period - spent);
+        }
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 void app_main()
@@ -208,6 +434,8 @@ void app_main()
     //doublebuff = false;
     fontback = TFT_BLACK;
 
+    tft_gcache_init(CONFIG_TFT_GLYPH_CACHE_SIZE);
+
     //ESP_LOGI(TAG, "After TFT init.\n");
 
     // Set timezone to Eastern Standard Time and print local time
@@ -216,12 +444,19 @@ void app_main()
     //tzset();
 
     // Cycle background colors
-    uint16_t color = 0, cnt = 0;
+    uint16_t color = 0;
 
     color = TFT_BLACK;
     //color = tft_color565(30, 30, 30);
     clear_screen(spi, color);
 
+    #ifdef CONFIG_TFT_BENCH
+    tft_bench_text(spi);
+    tft_bench_label(spi);
+    tft_bench_num(spi);
+    tft_bench_bars(spi);
+    #endif
+
     ESP_LOGI(TAG, "After CLS init.\n");
 
     wifi_preinit();
@@ -250,64 +485,45 @@ void app_main()
     //ESP_LOGI(TAG, "After font init.\n");
     //set_promiscuous();
 
-    int old_sec = 0;
-    while(true)
+    const tft_font_t *font16 = tft_font_get(TFT_FONT_16);
+    for(int loopc = 0; loopc < AP_ROWS; loopc++)
         {
-        time_t now; struct  tm timeinfo = { 0 };
-        time(&now); localtime_r(&now, &timeinfo);
-
-        if(old_sec !=  timeinfo.tm_sec)
-            {
-            old_sec =  timeinfo.tm_sec;
-
-            snprintf(tmp2, sizeof(tmp2), "Scanning (%d) ... ", cnt++);
-            draw_str(spi, (uint8_t*)tmp2, 16, 1, SCREEN_HEIGHT - 20, TFT_WHITE);
-
-            wcwifi_scan_start();
-
-            wcwifi_scan_get();
-
-            #if 1
-            draw_str(spi, (uint8_t*)"                     ",
-                                                16, 1, SCREEN_HEIGHT - 20, TFT_WHITE);
-
-            for(int loopc = 0; loopc < num_chs; loopc++)
-                {
-                if(loopc < 10)
-                    {
-                    snprintf(tmp2, sizeof(tmp2), "%-*.*s", 23, 23, ap_recs[loopc].ssid);
-
-                    //tmp2[50] = '\0';
-
-                    snprintf(tmp, sizeof(tmp), "%02d %s ",  loopc + 1, tmp2);
-
-                    snprintf(tmp3, sizeof(tmp3), "ch%-2d %2ddB %s",
-                                                    ap_recs[loopc].primary,
-                                                            ap_recs[loopc].rssi,
-                                                    trans_authmod(ap_recs[loopc].authmode)
-                                                    );
-
-                    //tmp[44] = '\0';             // Clip overshoot
-                    int top = 34 + 18 * loopc;
-                    int ppp = draw_str(spi, (uint8_t*)tmp, 16, 4, top, TFT_WHITE);
-                    //(void)ppp;
-                    tft_rect(spi, ppp, top, 210 - ppp, 16, TFT_BLACK);
+        int top = 34 + 18 * loopc;
+        tft_label_init(&ssid_labels[loopc], font16, 4, top, 201, 
+                    TFT_ALIGN_LEFT | TFT_LAYOUT_ELLIPSIS, TFT_WHITE, fontback);
+        tft_num_init(&chan_nums[loopc], font16, 205, top, 2, "ch", NULL,
+                                                        TFT_WHITE, fontback);
+        tft_num_init(&rssi_nums[loopc], font16, 237, top, 3, NULL, "dB",
+                                                        TFT_WHITE, fontback);
+        tft_label_init(&auth_labels[loopc], font16, 280, top, SCREEN_WIDTH - 282, 
+                    TFT_ALIGN_LEFT, TFT_WHITE, fontback);
+        }
+    tft_num_init(&scan_num, font16, 1, SCREEN_HEIGHT - 20, 2, "Scanning (", ") ...",
+                                                        TFT_WHITE, fontback);
+    tft_num_init(&next_num, font16, 124, SCREEN_HEIGHT - 20, 2, "next ", "s",
+                                                        TFT_WHITE, fontback);
+    tft_label_init(&view_label, font16, 200, SCREEN_HEIGHT - 20, SCREEN_WIDTH - 202,
+                    TFT_ALIGN_RIGHT, TFT_WHITE, fontback);
+
+    tft_bars_init(&power_bars, CHART_XX + 3, CHART_YY, CHART_PITCH, 7, CHART_HH,
+                        AP_CHAN_MAX, CHART_LO, CHART_HI, fontback);
+    tft_bars_init(&overlap_bars, CHART_XX + 11, CHART_YY, CHART_PITCH, 7, CHART_HH,
+                        AP_CHAN_MAX, CHART_LO, CHART_HI, fontback);
+    for(int loopc = 0; loopc < AP_CHAN_MAX; loopc++)
+        {
+        int left = CHART_XX + loopc * CHART_PITCH + 4;
+        tft_num_init(&chart_chans[loopc], font16, left, CHART_YY + CHART_HH + 4, 2,
+                                            NULL, NULL, TFT_WHITE, fontback);
+        tft_num_init(&chart_counts[loopc], font16, left, CHART_YY + CHART_HH + 22, 2,
+                                            NULL, NULL, TFT_WHITE, fontback);
+        }
+    // Drawing runs on its own, app_main only keeps the scan going
+    xTaskCreate(render_task, "render_task", 4096, spi, 2, NULL);
 
-                    int ppp2 = draw_str(spi, (uint8_t*)tmp3, 16, 205, top, TFT_WHITE);
-                    //(void)ppp2;
-                    //printf("ppp2=%d\n", ppp2);
-                    tft_rect(spi, ppp2, top, SCREEN_WIDTH - (ppp2+2), 16, TFT_BLACK);
-                    }
-                if(cnt >= 100)
-                    cnt = 0;
-                }
-            #endif
+    while(wcwifi_scan_start() != 0)
+        vTaskDelay(500 / portTICK_PERIOD_MS);
 
-            }
-        //forceARP();
-        vTaskDelay(200 / portTICK_RATE_MS);
-        printf("%d ", get_mem_usage()); fflush(stdout);
-        }
+    //forceARP();
 }
 
 // EOF
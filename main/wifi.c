@@ -38,6 +38,7 @@
 // ... predictable data concept
 
 #include <string.h>
+#include <stddef.h>
 #include <time.h>
 #include <stdio.h>
 #include <ctype.h>
@@ -58,6 +59,7 @@
 #include "nvs_flash.h"
 #include "esp_smartconfig.h"
 #include "esp_wps.h"
+#include "esp_timer.h"
 
 // Networking
 #include "lwip/err.h"
@@ -67,7 +69,11 @@
 #include "lwip/api.h"
 
 #include "utils.h"
+#include "ap_chan.h"
+#include "ap_table.h"
 #include "wifi.h"
+#include "scan_prof.h"
+#include "scan_sched.h"
 
 // Reach back to the project root
 //#include "../../wclock/main/wclock.h"
@@ -113,6 +119,7 @@ const int AP_END_BIT        = BIT8;
 const int WPS_DONE_BIT      = BIT10;
 const int WPS_ERR_BIT       = BIT11;
 const int WPS_TOUT_BIT      = BIT12;
+const int SLICED_BIT        = BIT13;
 
 //const int STA_START_BIT     = BIT0;     // Alias, not used
 
@@ -127,9 +134,6 @@ const int WPS_TOUT_BIT      = BIT12;
 
 EventGroupHandle_t wifi_event_group;
 
-uint16_t num_chs = 0;
-wifi_ap_record_t ap_recs[MAX_CHANNELS + 1];
-
 //char *apname = NULL, *appass = NULL, *stname = NULL, *stpass = NULL;
 char apname[PASS_SIZE], appass[PASS_SIZE], stname[PASS_SIZE], stpass[PASS_SIZE];
 
@@ -140,7 +144,27 @@ static  int inited = 0;
 
 wifi_ap_record_t  aprec;
 
-int trig_started = 0;
+#ifndef CONFIG_WIFI_SCAN_SLICE_CHANNELS
+#define CONFIG_WIFI_SCAN_SLICE_CHANNELS 1
+#endif
+
+#ifndef CONFIG_WIFI_AP_MAX_AGE
+#define CONFIG_WIFI_AP_MAX_AGE          120
+#endif
+
+#ifndef CONFIG_WIFI_SCHED_MIN_MS
+#define CONFIG_WIFI_SCHED_MIN_MS        500
+#endif
+#ifndef CONFIG_WIFI_SCHED_MAX_MS
+#define CONFIG_WIFI_SCHED_MAX_MS        60000
+#endif
+#ifndef CONFIG_WIFI_SCHED_CHURN
+#define CONFIG_WIFI_SCHED_CHURN         2
+#endif
+
+#define SCAN_SLICE_CHANNELS CONFIG_WIFI_SCAN_SLICE_CHANNELS
+#define SCAN_CHANNEL_MAX    64      // Records fetched per channel, at most
+#define SCAN_MAX_AGE        CONFIG_WIFI_AP_MAX_AGE
 
 //////////////////////////////////////////////////////////////////////////
 // CONFIG
@@ -263,7 +287,7 @@ static esp_err_t event_handler(void *ctx, system_event_t *event)
 
         case SYSTEM_EVENT_SCAN_DONE:
             //ESP_LOGI(TAG, "SYSTEM_EVENT_SCAN_DONE");
-            xEventGroupSetBits(wifi_event_group, SCANNED_BIT);
+            // One channel done. The scan task flags slices and sweeps.
             xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
             break;
 
@@ -548,24 +572,29 @@ int     wifi_connect()
     ESP_LOGI(TAG, "Connecting to: '%s' pass: '%s'\n",
                     wifi_config.sta.ssid, wifi_config.sta.password);
 
-    EventBits_t uxBits = 0;
-    uxBits = xEventGroupWaitBits(wifi_event_group, SCANNING_BIT,
-                                  false, true, 20 / portTICK_PERIOD_MS);
+    // Hold the sweep at the next channel, wait out the one in flight.
+    // The bit goes up before SCANNING_BIT is looked at, scan_channel()
+    // does the same the other way round.
+    xEventGroupSetBits(wifi_event_group, CONNECTING_BIT);
+
+    EventBits_t uxBits = xEventGroupGetBits(wifi_event_group);
+    for(int loop = 0; loop < 2 * SCAN_PROF_DWELL_MAX / 10 + 10; loop++)
+        {
+        if(!(uxBits & SCANNING_BIT))
+            break;
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+        uxBits = xEventGroupGetBits(wifi_event_group);
+        }
 
     //ESP_LOGI(TAG, "wifi_connect() uxBits %x\n", uxBits);
 
     if(uxBits & SCANNING_BIT)
         {
         ESP_LOGI(TAG, "Cannot connect, scanning in progress ... \n");
-
-        // Allow it to break in the second time
-        //xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
-
+        xEventGroupClearBits(wifi_event_group, CONNECTING_BIT);
         return wifi_connected;
         }
 
-    xEventGroupSetBits(wifi_event_group, CONNECTING_BIT);
-
     ESP_ERROR_CHECK(esp_wifi_connect());
 
     // Wait for connect, max 15 sec
@@ -582,39 +611,228 @@ int     wifi_connect()
 }
 
 //////////////////////////////////////////////////////////////////////////
+// Sliced scan. A sweep goes channel by channel, one esp_wifi_scan_start
+// each, and merges every channel's results into the AP table right away.
+// Once started it sweeps until wcwifi_scan_stop(), scan_sched sets the
+// idle time between sweeps.
+//
+// Only the scan task touches the table. After every slice it publishes
+// a snapshot, a copy of the present APs, into one of WIFI_SNAPS slots,
+// never the newest one. Each slot is a seqlock: seq is odd while it is
+// written. The slot index goes out after the data, then the generation.
+// Readers copy the newest slot out and take the copy if seq has not
+// moved, any number of them, nobody waits on anybody.
 
-static void  wcwifi_scan_task(void * parm)
+typedef struct _snap_slot
 
 {
-    static wifi_scan_config_t scfg;
+    volatile uint32_t seq;
+    wifi_snap_t snap;
+
+} snap_slot;
+
+#define SNAP_TRIES  4               // Copies a reader tries
+
+static ap_table_t scan_tab;
+
+static snap_slot *slots = NULL;
+static volatile int snap_newest = -1;
+static volatile uint32_t snap_gen = 0;
+static uint32_t snap_sweeps = 0;
+static uint32_t scan_dropped = 0;           // Past SCAN_CHANNEL_MAX, this sweep
+static volatile int scan_run = false;
+
+static scan_sched_t sched;
 
-    memset(&scfg, 0, sizeof(scfg));
-    scfg.show_hidden = TRUE;
+static uint32_t scan_now()
 
-    // Prevent re-scan if the data less than 30 sec. old
-    // (disabled it)
-    //int ttt = time(NULL);
-    //if(ttt - old_scan < 30)
-    //    return;
-    //old_scan = ttt;
+{
+    return (uint32_t)(esp_timer_get_time() / 1000000);
+}
 
+static void scan_channel(wifi_scan_config_t *scfg, int chan)
+
+{
+    static wifi_ap_record_t recs[SCAN_CHANNEL_MAX];
+    uint16_t found = 0, cnt;
+
+    scfg->channel = chan;
+
+    // A connect goes first. Both sides raise their bit before they look
+    // at the other's, so the two can not both go ahead.
     while(true)
         {
-        TAKE_SEMA(iSemaphore, TAG, portMAX_DELAY);
+        xEventGroupSetBits(wifi_event_group, SCANNING_BIT);
+        if(!(xEventGroupGetBits(wifi_event_group) & CONNECTING_BIT))
+            break;
+        xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
+        while(xEventGroupGetBits(wifi_event_group) & CONNECTING_BIT)
+            vTaskDelay(50 / portTICK_PERIOD_MS);
+        }
+    esp_err_t err = esp_wifi_scan_start(scfg, true);
+    xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
+
+    // All the driver found, as far as the buffer goes. Fetching also
+    // frees the driver's list, the records not fetched with it.
+    if(err != ESP_OK || esp_wifi_scan_get_ap_num(&found) != ESP_OK)
+        found = 0;
+    cnt = MIN(found, SCAN_CHANNEL_MAX);
+    if(err != ESP_OK || esp_wifi_scan_get_ap_records(&cnt, recs) != ESP_OK)
+        cnt = 0;
+    if(found > cnt)
+        scan_dropped += found - cnt;
+
+    ap_table_merge(&scan_tab, chan, recs, cnt, scan_now());
+}
+
+// Copy the present APs, one missed scan of their channel is forgiven
+
+static void snap_fill(wifi_snap_t *snap, int chan, int done)
+
+{
+    ap_entry_t *ee; int iter = 0;
+
+    snap->gen = snap_gen + 1;
+    snap->sweeps = snap_sweeps;
+    snap->time = scan_now();
+    snap->chan = chan; snap->done = done;
+    snap->idle_ms = sched.idle_ms;
+    snap->saved = sched.saved;
+    snap->duty = scan_sched_duty(&sched);
+    snap->total = scan_tab.count;
+    snap->chans = scan_tab.chan;
+    snap->count = 0;
+
+    while((ee = ap_table_next(&scan_tab, &iter)) != NULL)
+        {
+        if(ee->missed <= 1 && snap->count < WIFI_SNAP_MAX)
+            snap->aps[snap->count++] = *ee;
+        }
+}
+
+// Returns the APs present
+
+static int  snap_publish(int chan, int done)
+
+{
+    if(slots == NULL)
+        return 0;
+
+    int idx = (snap_newest + 1) % WIFI_SNAPS;
+    snap_slot *ss = &slots[idx];
+    wifi_snap_t *snap = &ss->snap;
+
+    ss->seq++;
+    __sync_synchronize();
+    snap_fill(snap, chan, done);
+    __sync_synchronize();
+    ss->seq++;
+
+    // Readers see the slot before the generation, never the other way
+    snap_newest = idx;
+    __sync_synchronize();
+    snap_gen = snap->gen;
+
+    if(!done)
+        return snap->count;
+
+    ESP_LOGI(TAG, "Sweep %d, %d APs, %d present, generation %d", snap->sweeps,
+                                snap->total, snap->count, snap->gen);
+    ESP_LOGI(TAG, "Churn %d, idle %d ms, %d sweeps saved, radio %d%%",
+                sched.last_churn, snap->idle_ms, snap->saved, snap->duty);
+    if(scan_dropped)
+        ESP_LOGI(TAG, "Dropped %d records, over %d on a channel", scan_dropped,
+                                                        SCAN_CHANNEL_MAX);
+    for(int loopc = 0; loopc < snap->count; loopc++)
+        {
+        ESP_LOGI(TAG, "Got AP '%s' on channel %d auth: %d signal: %d ",
+                                snap->aps[loopc].ssid,
+                                    snap->aps[loopc].primary,
+                                        snap->aps[loopc].authmode,
+                                            snap->aps[loopc].rssi
+                                        );
+        printauth(snap->aps[loopc].authmode);
+        }
+    return snap->count;
+}
+
+// Scan config from the profile
+
+static void scan_config(wifi_scan_config_t *scfg, const scan_parm_t *parm)
+
+{
+    memset(scfg, 0, sizeof(*scfg));
+    scfg->show_hidden = parm->hidden;
+    if(parm->passive)
+        {
+        scfg->scan_type = WIFI_SCAN_TYPE_PASSIVE;
+        scfg->scan_time.passive = parm->passive_ms;
+        }
+    else
+        {
+        scfg->scan_type = WIFI_SCAN_TYPE_ACTIVE;
+        scfg->scan_time.active.min = parm->active_min;
+        scfg->scan_time.active.max = parm->active_max;
+        }
+}
+
+static void  wcwifi_scan_task(void * parm)
+
+{
+    static wifi_scan_config_t scfg;
+    uint32_t churned = 0;
+
+    while(true)
+        {
+        // Parked until started
+        if(!scan_run)
+            TAKE_SEMA(iSemaphore, TAG, portMAX_DELAY);
 
         xEventGroupClearBits(wifi_event_group, SCANNED_BIT);
 
-        ESP_LOGI(TAG, "Started WiFi scan, setting scanning bit ...");
+        // A profile switch applies from here
+        int prof = scan_prof_curr();
+        scan_parm_t sparm = scan_prof_get(prof)->parm;
+        scan_config(&scfg, &sparm);
 
-        xEventGroupSetBits(wifi_event_group, SCANNING_BIT);
-        trig_started = true;
-        esp_wifi_scan_start(&scfg, true);
-        trig_started = false;
+        //ESP_LOGI(TAG, "Started WiFi sweep ...");
 
-        ESP_LOGI(TAG, "Started WiFi scan, re setting scanning bit ...");
-        xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
+        int64_t start = esp_timer_get_time();
+        int last = 0, inslice = 0;
+        scan_dropped = 0;
+        for(int chan = 1; chan <= AP_CHAN_MAX; chan++)
+            {
+            if(!(sparm.chans & SCAN_PROF_CHAN(chan)))
+                continue;
+
+            scan_channel(&scfg, chan);
+            last = chan;
+
+            // Slice done, unless it was the last channel
+            if(++inslice >= SCAN_SLICE_CHANNELS && (sparm.chans >> (chan + 1)))
+                {
+                snap_publish(chan, false);
+                xEventGroupSetBits(wifi_event_group, SLICED_BIT);
+                inslice = 0;
+                }
+            }
+        ap_table_age(&scan_tab, scan_now(), SCAN_MAX_AGE);
+        snap_sweeps++;
+
+        // Quiet air stretches the idle time, change cuts it back
+        uint32_t sweep_ms = (esp_timer_get_time() - start) / 1000;
+        uint32_t churn = scan_tab.added + scan_tab.gone + scan_tab.moved;
+        uint32_t idle = scan_sched_next(&sched, churn - churned, sweep_ms);
+        churned = churn;
+
+        int aps = snap_publish(last, true);
+        scan_prof_sweep(prof, sweep_ms, aps);
+
+        xEventGroupSetBits(wifi_event_group, SLICED_BIT | SCANNED_BIT);
 
-        vTaskDelay(50 / portTICK_PERIOD_MS);
+        // Idle, wcwifi_scan_now() ends it early. Also lets the lower
+        // priority tasks in.
+        xSemaphoreTake(iSemaphore, MAX(idle, 10) / portTICK_PERIOD_MS);
         }
 
     //ESP_LOGI(TAG, "Ended WiFi scan.");
@@ -622,6 +840,8 @@ static void  wcwifi_scan_task(void * parm)
     vTaskDelete(NULL);
 }
 
+// Start sweeping, back to back until stopped
+
 int     wcwifi_scan_start(void)
 {
 
@@ -639,55 +859,82 @@ int     wcwifi_scan_start(void)
         ESP_LOGI(TAG, "Connecting bit set.\n");
         ret = -1;
         }
-    else
+    else if(!scan_run)
         {
+        scan_run = true;
         GIVE_SEMA(iSemaphore);
         }
-    return 0;
+    return ret;
 }
 
-//////////////////////////////////////////////////////////////////////////
-// Get the result of the scan ...
+// Cut the idle time short, sweep now
 
-void    wcwifi_scan_get(void)
+void    wcwifi_scan_now(void)
 
 {
-    xEventGroupWaitBits(wifi_event_group, SCANNED_BIT,
-                        false, true, 5000 / portTICK_PERIOD_MS);
+    if(scan_run)
+        GIVE_SEMA(iSemaphore);
+}
+
+// The sweep in progress completes, then the task parks
+
+void    wcwifi_scan_stop(void)
+
+{
+    scan_run = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Generation of the newest snapshot, 0 before the first. Unchanged,
+// there is nothing new to read.
 
-    xEventGroupClearBits(wifi_event_group, SCANNED_BIT);
+uint32_t wcwifi_snap_gen(void)
 
-    // Just to be sure
-    //xEventGroupClearBits(wifi_event_group, SCANNING_BIT);
+{
+    return snap_gen;
+}
 
-    esp_wifi_scan_get_ap_num(&num_chs);
+// Copy of the newest snapshot, complete and consistent. The copy goes
+// to *spare, once it checks out *snap and *spare swap, so *snap is the
+// new snapshot and *spare the old one, free for the next read. False
+// if there is none yet, or the scan task lapped every try (try again
+// later), *snap is then left as it was, *spare holds scraps.
 
-    ESP_LOGI(TAG, "Got %d channels", num_chs);
-    memset(ap_recs, 0, sizeof(ap_recs));
-    num_chs = MIN(MAX_CHANNELS, num_chs);
-    ESP_ERROR_CHECK(
-        esp_wifi_scan_get_ap_records(&num_chs, ap_recs));
+int     wcwifi_snap_read(wifi_snap_t **snap, wifi_snap_t **spare)
 
-    for(int loopc = 0; loopc < num_chs; loopc++)
+{
+    wifi_snap_t *dst = *spare;
+
+    for(int loop = 0; loop < SNAP_TRIES; loop++)
         {
-        ESP_LOGI(TAG, "Got AP '%s' (%s) on channel %d auth: %d signal: %d ",
-                                ap_recs[loopc].ssid,
-                                    ap_recs[loopc].bssid,
-                                        ap_recs[loopc].primary,
-                                            ap_recs[loopc].authmode,
-                                                ap_recs[loopc].rssi
-                                        );
-        printauth(ap_recs[loopc].authmode);
+        int idx = snap_newest;
+        if(idx < 0 || slots == NULL)
+            return false;
+
+        snap_slot *ss = &slots[idx];
+        uint32_t seq = ss->seq;
+        __sync_synchronize();
+        if(seq & 1)
+            {
+            taskYIELD();
+            continue;
+            }
+
+        // Header, then only the APs it holds
+        int count = MIN(MAX(ss->snap.count, 0), WIFI_SNAP_MAX);
+        memcpy(dst, &ss->snap, offsetof(wifi_snap_t, aps));
+        memcpy(dst->aps, ss->snap.aps, count * sizeof(ap_entry_t));
 
-        //ESP_LOGI(TAG, "AP '%s' ch: %d ",
-        //                        ap_recs[loopc].ssid,
-        //                                ap_recs[loopc].primary
-        //                                );
-        // Feed watchdog
+        __sync_synchronize();
+        if(ss->seq == seq)
+            {
+            dst->count = count;
+            *spare = *snap;
+            *snap = dst;
+            return true;
+            }
         }
-    FEED_DOG
-    trig_started = false;
-    //ESP_LOGI(TAG, "Done scan.");
+    return false;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -785,8 +1032,16 @@ void    wifi_preinit()
     strcat((char*)ap_wifi_config.ap.ssid, tmp);
     ESP_LOGI(TAG,"Decorated sta ssid %s", ap_wifi_config.ap.ssid);
 
-    xTaskCreate(wcwifi_scan_task, "wcwifi_scan_task", 4096, NULL, 3, NULL);
+    ap_table_init(&scan_tab);
+    slots = heap_caps_malloc(WIFI_SNAPS * sizeof(snap_slot),
+                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if(slots != NULL)
+        memset(slots, 0, WIFI_SNAPS * sizeof(snap_slot));
+    scan_prof_load();
+    scan_sched_init(&sched, CONFIG_WIFI_SCHED_MIN_MS, CONFIG_WIFI_SCHED_MAX_MS,
+                                                CONFIG_WIFI_SCHED_CHURN);
     CREATE_SEMA(iSemaphore); TAKE_SEMA(iSemaphore, TAG, portMAX_DELAY);
+    xTaskCreate(wcwifi_scan_task, "wcwifi_scan_task", 4096, NULL, 3, NULL);
 
     inited = 1;
 }
@@ -13,9 +13,34 @@
 
    ======================================================================= */
 
-#define MAX_CHANNELS 10
 #define PASS_SIZE 48
 
+#define WIFI_SNAP_MAX   AP_TABLE_MAX
+#define WIFI_SNAPS      2       // Snapshot slots, newest and next
+
+// Scan result snapshot, the present APs in table order, ap_view sorts
+// them, and the channel stats. Readers get their own copy, read into
+// a spare and swapped in whole.
+// (include ap_chan.h and ap_table.h first)
+
+typedef struct _wifi_snap_t
+
+{
+    uint32_t gen;                       // Generation, counts snapshots
+    uint32_t sweeps;                    // Sweeps completed
+    uint32_t time;                      // Seconds since boot
+    uint32_t idle_ms;                   // Before the next sweep
+    uint32_t saved;                     // Sweeps skipped by the scheduler
+    int16_t  chan;                      // Last channel scanned
+    int16_t  done;                      // Taken at the end of a sweep
+    int16_t  total;                     // APs in the table
+    int16_t  count;                     // APs in aps[]
+    int16_t  duty;                      // Percent of time sweeping
+    ap_chan_t chans;                    // Channel stats
+    ap_entry_t aps[WIFI_SNAP_MAX];
+
+} wifi_snap_t;
+
 // Exported values
 
 extern const int WIFI_START_BIT    ;
@@ -31,6 +56,7 @@ extern const int AP_END_BIT        ;
 extern const int WPS_DONE_BIT      ;
 extern const int WPS_ERR_BIT       ;
 extern const int WPS_TOUT_BIT      ;
+extern const int SLICED_BIT        ;
 
 extern EventGroupHandle_t wifi_event_group;
 
@@ -38,11 +64,6 @@ extern wifi_ap_record_t  aprec;
 
 void print_wifi_bits(EventBits_t nnn);
 
-// Expose scan specific variables and functions
-
-extern uint16_t num_chs;
-extern wifi_ap_record_t ap_recs[];
-
 extern wifi_config_t ap_wifi_config;
 extern char apname[], appass[], stname[], stpass[];
         
@@ -60,7 +81,12 @@ void    wcwifi_ap_init(char *ssid_str, char *pass_str);
 void    wcwifi_sta_init(char *sta_str, char *sta_pass);
 
 int     wcwifi_scan_start(void);
-void    wcwifi_scan_get(void);
+void    wcwifi_scan_stop(void);
+void    wcwifi_scan_now(void);
+
+uint32_t wcwifi_snap_gen(void);
+int     wcwifi_snap_read(wifi_snap_t **snap, wifi_snap_t **spare);
+
 void    set_promiscuous();
 int     smartconfig();
 void    start_wps(int delay);
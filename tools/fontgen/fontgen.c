@@ -0,0 +1,900 @@
+//////////////////////////////////////////////////////////////////////////
+// Font generator. Compiles on linux.
+//
+// Makes a font source file for main/ from a BDF or TTF font, or from
+// one of the fonts already in the tree. Only the code points asked for
+// are generated, so a clock font can ship the digits alone.
+//
+// Output layouts:
+//
+//   fixed    widtbl / chrtbl cell rows, the same as Font16.c
+//   packed   bounding box trimmed (same as Adafruit GFX), bits back 
+//            to back, no row padding. Also called gfx.
+//   aa       anti aliased: the source is sampled down by the factor, 
+//            the coverage of each factor x factor block is stored in 
+//            bpp (2 or 4) bits. TTF renders grey directly.
+//
+// Sparse code point sets get a range table. The flash size of the 
+// result is printed on stderr.
+//
+// Build and run from this directory:
+//
+//   gcc -I../../main -o fontgen fontgen.c ../../main/Font32.c 
+//                      ../../main/Font64.c ../../main/Font24.c
+//
+// TTF input needs FreeType:
+//
+//   gcc -DUSE_FREETYPE $(pkg-config --cflags freetype2) -I../../main 
+//          -o fontgen fontgen.c ../../main/Font32.c ../../main/Font64.c
+//              ../../main/Font24.c $(pkg-config --libs freetype2)
+//
+// Examples:
+//
+//   ./fontgen -bdf 6x13.bdf -fmt fixed -name f13 > ../../main/Font13.c
+//   ./fontgen -ttf Sans.ttf -size 48 -chars 0x30-0x3a -fmt aa -bpp 4 
+//                  -name clock48 > ../../main/Clock48.c
+//
+// The font is named tft_font_<name>, registry slot TFT_FONT_<NAME>
+// (-id to change), glyph tables are <prefix>_<name>. 
+//
+// The files in the tree were made with the short forms:
+//
+//   ./fontgen 32 > ../../main/Font32pk.c
+//   ./fontgen 64 > ../../main/Font64pk.c
+//   ./fontgen -aa 4 2 sans24 sans12aa > ../../main/Font12aa.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+
+#ifdef USE_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+#include "tft_fonts.h"
+
+#define MARGIN      32          // Room left of the pen position
+#define MAX_GLYPHS  1024
+#define MAX_CODE    0x110000
+
+#define MIN(aa, bb) ((aa) < (bb) ? (aa) : (bb))
+#define MAX(aa, bb) ((aa) > (bb) ? (aa) : (bb))
+
+// Glyph bitmap, one byte per pixel (coverage 0 .. pix_max)
+
+static unsigned char pix[256][256];
+static int  pix_max = 1;
+
+static unsigned char out[65536];
+static int  outbits = 0;
+
+static tft_gfx_glyph_t glyphs[MAX_GLYPHS];
+static unsigned int codes[MAX_GLYPHS];
+
+static int  get_bit(const unsigned char *row, int xx)
+
+{
+    return (row[xx >> 3] >> (7 - (xx & 7))) & 1;
+}
+
+static void put_bits(int val, int bpp)
+
+{
+    for(int loop = bpp - 1; loop >= 0; loop--)
+        {
+        if((val >> loop) & 1)
+            out[outbits >> 3] |= 0x80 >> (outbits & 7);
+        outbits++;
+        }
+}
+
+// Source glyph into pix, cell rows down, pen at column MARGIN. 
+// Returns the advance.
+
+static int  load_glyph(const tft_font_t *font, int idx)
+
+{
+    memset(pix, 0, sizeof(pix));
+    
+    if(font->format == TFT_FONT_FMT_GFX)
+        {
+        const tft_gfx_glyph_t *gg = &font->glyphs[idx];
+        const unsigned char *bits = font->bitmap + gg->offset;
+        int bit = 0;
+        
+        for(int yy = 0; yy < gg->height; yy++)
+            for(int xx = 0; xx < gg->width; xx++, bit++)
+                pix[font->baseline + gg->yoffset + yy][MARGIN + gg->xoffset + xx] = 
+                                                    get_bit(bits, bit);
+        return gg->xadvance;
+        }
+    int width = font->widtbl[idx], bytes = (width + 7) / 8;
+    for(int yy = 0; yy < font->height; yy++)
+        for(int xx = 0; xx < width; xx++)
+            pix[yy][MARGIN + xx] = get_bit(font->chrtbl[idx] + yy * bytes, xx);
+    return width;
+}
+
+// Sample pix down by factor, coverage to levels - 1. The baseline 
+// lands on a block boundary.
+
+static void shrink(int factor, int levels, int baseline)
+
+{
+    static unsigned char tmp[256][256];
+    int pad = (factor - baseline % factor) % factor;
+    
+    memset(tmp, 0, sizeof(tmp));
+    for(int yy = 0; yy < 256 / factor; yy++)
+        for(int xx = 0; xx < 256 / factor; xx++)
+            {
+            int cov = 0;
+            for(int y2 = 0; y2 < factor; y2++)
+                for(int x2 = 0; x2 < factor; x2++)
+                    {
+                    int sy = yy * factor + y2 - pad;
+                    int sx = MARGIN + (xx - MARGIN / factor) * factor + x2;
+                    if(sy >= 0 && sy < 256 && sx >= 0 && sx < 256)
+                        cov += pix[sy][sx];
+                    }
+            int full = factor * factor * pix_max;
+            tmp[yy][MARGIN - MARGIN / factor + xx] = 
+                        (cov * (levels - 1) + full / 2) / full;
+            }
+    memcpy(pix, tmp, sizeof(pix));
+}
+
+// Trim to the box, store at bpp. Glyphs start on a byte.
+
+static void emit_glyph(int idx, int advance, int baseline, int height, int bpp)
+
+{
+    int left = 256, right = -1, top = height, bottom = -1;
+    
+    for(int yy = 0; yy < height; yy++)
+        for(int xx = 0; xx < 256; xx++)
+            {
+            if(pix[yy][xx])
+                {
+                if(xx < left)   left = xx;
+                if(xx > right)  right = xx;
+                if(yy < top)    top = yy;
+                if(yy > bottom) bottom = yy;
+                }
+            }
+    // Empty glyph, no box
+    if(right < 0)
+        {
+        left = MARGIN; right = left - 1; top = baseline; bottom = top - 1;
+        }
+    glyphs[idx].offset = outbits / 8;
+    glyphs[idx].width = right - left + 1;
+    glyphs[idx].height = bottom - top + 1;
+    glyphs[idx].xadvance = advance;
+    glyphs[idx].xoffset = left - MARGIN;
+    glyphs[idx].yoffset = top - baseline;
+    
+    for(int yy = top; yy <= bottom; yy++)
+        for(int xx = left; xx <= right; xx++)
+            put_bits(pix[yy][xx], bpp);
+            
+    outbits = (outbits + 7) & ~7;
+    if(outbits / 8 > 65535)
+        {
+        fprintf(stderr, "Glyph bits over 64k\n");
+        exit(1);
+        }
+}
+
+static const tft_font_t *find_font(const char *name)
+
+{
+    if(strcmp(name, "32") == 0)
+        return &tft_font_f32;
+    if(strcmp(name, "64") == 0)
+        return &tft_font_f64;
+    if(strcmp(name, "sans24") == 0)
+        return &tft_font_sans24;
+    fprintf(stderr, "No font '%s'\n", name);
+    exit(1);
+}
+
+static void print_tables(const char *name, int count)
+
+{
+    printf("const unsigned char %s_bits[%d] = \n{", name, outbits / 8);
+    for(int loop = 0; loop < outbits / 8; loop++)
+        printf("%s0x%02X,", loop % 12 ? " " : "\n    ", out[loop]);
+    printf("\n};\n\n");
+    
+    printf("const tft_gfx_glyph_t %s_glyphs[%d] = \n{\n", name, count);
+    for(int loop = 0; loop < count; loop++)
+        {
+        tft_gfx_glyph_t *gg = &glyphs[loop];
+        printf("    { %5d, %3d, %3d, %3d, %3d, %3d },   // 0x%02X\n", 
+                    gg->offset, gg->width, gg->height, gg->xadvance, 
+                        gg->xoffset, gg->yoffset, codes[loop]);
+        }
+    printf("};\n\n");
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Anti aliased font from a 1 bit one
+
+static int  make_aa(int bpp, int factor, const char *name, const char *outname)
+
+{
+    const tft_font_t *font = find_font(name);
+    int levels = 1 << bpp;
+    char tab[32], id[32];
+    
+    if((bpp != 2 && bpp != 4) || factor < 1 || factor > 4)
+        {
+        fprintf(stderr, "Bad bpp %d or factor %d\n", bpp, factor);
+        exit(1);
+        }
+    int baseline = font->format == TFT_FONT_FMT_GFX ? font->baseline : 0;
+    int pad = (factor - baseline % factor) % factor;
+    int height = (font->height + pad + factor - 1) / factor;
+    int base2 = (baseline + pad) / factor;
+    
+    for(int idx = 0; idx < font->count; idx++)
+        {
+        int advance = load_glyph(font, idx);
+        codes[idx] = font->first + idx;
+        shrink(factor, levels, baseline);
+        emit_glyph(idx, (advance + factor / 2) / factor, base2, height, bpp);
+        }
+    int size = outbits / 8 + font->count * sizeof(tft_gfx_glyph_t);
+    fprintf(stderr, "Font %s / %d at %d bpp: %d rows, %d bytes\n", 
+                                    name, factor, bpp, height, size);
+    
+    printf("// Font %s sampled down by %d, %d bpp anti aliased. Generated by "
+                "tools/fontgen, do not edit.\n\n", name, factor, bpp);
+    printf("#include <stdlib.h>\n\n#include \"tft_fonts.h\"\n\n");
+    
+    snprintf(tab, sizeof(tab), "font_%s", outname);
+    print_tables(tab, font->count);
+    
+    int len = 0;
+    for(; len < (int)sizeof(id) - 1 && outname[len]; len++)
+        id[len] = toupper(outname[len]);
+    id[len] = '\0';
+        
+    printf("const tft_font_t tft_font_%s = \n{\n"
+           "    .id = TFT_FONT_%s, .first = %d, .count = %d, .height = %d,\n"
+           "    .gap = %d, .scale = 1, .format = TFT_FONT_FMT_AA,\n"
+           "    .bitmap = %s_bits, .glyphs = %s_glyphs,\n"
+           "    .baseline = %d, .bpp = %d\n};\n\n",
+                outname, id, font->first, font->count, height, font->gap, 
+                    tab, tab, base2, bpp);
+    printf("// EOF\n");
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fixed cell font to bounding box packed
+
+static int  make_packed(int size)
+
+{
+    const tft_font_t *font;
+    char name[32];
+    
+    if(size == 32)
+        font = &tft_font_f32;
+    else if(size == 64)
+        font = &tft_font_f64;
+    else
+        {
+        fprintf(stderr, "No font for size %d\n", size);
+        exit(1);
+        }
+    int raw = 0;
+    for(int idx = 0; idx < font->count; idx++)
+        {
+        raw += (font->widtbl[idx] + 7) / 8 * font->height;
+        int advance = load_glyph(font, idx);
+        codes[idx] = font->first + idx;
+        emit_glyph(idx, advance, 0, font->height, 1);
+        }
+    int packed = outbits / 8 + font->count * sizeof(tft_gfx_glyph_t);
+    fprintf(stderr, "Font %d: raw %d bytes (+ %d pointers), packed %d bytes\n", 
+                size, raw, font->count * (int)sizeof(void *), packed);
+                
+    printf("// Font size %d, bounding box packed. Generated by tools/fontgen, "
+                "do not edit.\n\n", size);
+    printf("#include <stdlib.h>\n\n#include \"tft_fonts.h\"\n\n");
+    
+    snprintf(name, sizeof(name), "fontpk_f%d", size);
+    print_tables(name, font->count);
+    
+    printf("const tft_font_t tft_font_f%dpk = \n{\n"
+           "    .id = TFT_FONT_%d, .first = %d, .count = %d, .height = %d,\n"
+           "    .gap = %d, .scale = 1, .format = TFT_FONT_FMT_GFX,\n"
+           "    .bitmap = fontpk_f%d_bits, .glyphs = fontpk_f%d_glyphs\n};\n\n",
+                size, size, font->first, font->count, font->height, font->gap,
+                    size, size);
+    
+    if(size == 64)
+        {
+        printf("// Fake larger font by duplicating pixels\n\n");
+        printf("const tft_font_t tft_font_f128pk = \n{\n"
+           "    .id = TFT_FONT_128, .first = %d, .count = %d, .height = %d,\n"
+           "    .gap = %d, .scale = 2, .format = TFT_FONT_FMT_GFX,\n"
+           "    .bitmap = fontpk_f64_bits, .glyphs = fontpk_f64_glyphs\n};\n\n",
+                font->first, font->count, font->height, font->gap);
+        }
+    printf("// EOF\n");
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Sources. Each loads a code point into pix, returns the advance, or 
+// -1 if the font has no such glyph.
+
+static int  src_height, src_baseline;   // Cell rows, rows above baseline
+static int  (*src_load)(unsigned int code);
+
+// Font in the tree
+
+static const tft_font_t *tree_font;
+
+static int  load_tree(unsigned int code)
+
+{
+    if(code < (unsigned)tree_font->first || 
+            code >= (unsigned)(tree_font->first + tree_font->count))
+        return -1;
+    return load_glyph(tree_font, code - tree_font->first);
+}
+
+static void open_tree(const char *name)
+
+{
+    tree_font = find_font(name);
+    src_height = tree_font->height;
+    src_baseline = tree_font->format == TFT_FONT_FMT_GFX ? tree_font->baseline : 0;
+    src_load = load_tree;
+}
+
+// BDF, taken at its own pixel size
+
+typedef struct _bdf_glyph
+
+{
+    int     code;                       // -1: unencoded
+    int     advance;
+    int     ww, hh, xoff, yoff;         // BBX, yoff up from baseline
+    int     offset;                     // First row in bdf_bits
+
+} bdf_glyph;
+
+static bdf_glyph *bdf_glyphs;
+static int  bdf_count;
+static unsigned char *bdf_bits;
+static int  bdf_len;
+
+static int  load_bdf(unsigned int code)
+
+{
+    memset(pix, 0, sizeof(pix));
+    
+    for(int loop = 0; loop < bdf_count; loop++)
+        {
+        bdf_glyph *gg = &bdf_glyphs[loop];
+        if(gg->code != (int)code)
+            continue;
+            
+        int bytes = (gg->ww + 7) / 8;
+        for(int yy = 0; yy < gg->hh; yy++)
+            for(int xx = 0; xx < gg->ww; xx++)
+                {
+                int py = src_baseline - (gg->yoff + gg->hh) + yy;
+                int px = MARGIN + gg->xoff + xx;
+                if(py >= 0 && py < 256 && px >= 0 && px < 256)
+                    pix[py][px] = get_bit(bdf_bits + gg->offset + yy * bytes, xx);
+                }
+        return gg->advance;
+        }
+    return -1;
+}
+
+static void open_bdf(const char *fname)
+
+{
+    char line[1024];
+    int ascent = -1, descent = -1, bbh = 0, bby = 0, alloc = 0;
+    bdf_glyph *gg = NULL;
+    
+    FILE *fp = fopen(fname, "r");
+    if(fp == NULL)
+        {
+        fprintf(stderr, "Cannot open '%s'\n", fname);
+        exit(1);
+        }
+    while(fgets(line, sizeof(line), fp))
+        {
+        if(sscanf(line, "FONT_ASCENT %d", &ascent) == 1)
+            continue;
+        if(sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+            continue;
+        if(sscanf(line, "FONTBOUNDINGBOX %*d %d %*d %d", &bbh, &bby) == 2)
+            continue;
+        if(strncmp(line, "STARTCHAR", 9) == 0)
+            {
+            if(bdf_count == alloc)
+                {
+                alloc = alloc ? alloc * 2 : 256;
+                bdf_glyphs = realloc(bdf_glyphs, alloc * sizeof(bdf_glyph));
+                }
+            gg = &bdf_glyphs[bdf_count++];
+            memset(gg, 0, sizeof(*gg));
+            gg->code = -1;
+            continue;
+            }
+        if(gg == NULL)
+            continue;
+        if(sscanf(line, "ENCODING %d", &gg->code) == 1)
+            continue;
+        if(sscanf(line, "DWIDTH %d", &gg->advance) == 1)
+            continue;
+        if(sscanf(line, "BBX %d %d %d %d", &gg->ww, &gg->hh, &gg->xoff, 
+                                                &gg->yoff) == 4)
+            continue;
+        if(strncmp(line, "BITMAP", 6) == 0)
+            {
+            int bytes = (gg->ww + 7) / 8;
+            gg->offset = bdf_len;
+            bdf_len += gg->hh * bytes;
+            bdf_bits = realloc(bdf_bits, bdf_len);
+            for(int yy = 0; yy < gg->hh; yy++)
+                {
+                if(!fgets(line, sizeof(line), fp))
+                    break;
+                for(int xx = 0; xx < bytes; xx++)
+                    {
+                    unsigned int val = 0;
+                    sscanf(line + 2 * xx, "%2x", &val);
+                    bdf_bits[gg->offset + yy * bytes + xx] = val;
+                    }
+                }
+            continue;
+            }
+        if(strncmp(line, "ENDCHAR", 7) == 0)
+            {
+            if(gg->code < 0)
+                bdf_count--;
+            gg = NULL;
+            }
+        }
+    fclose(fp);
+    
+    if(ascent < 0 || descent < 0)
+        {
+        ascent = bbh + bby; descent = -bby;
+        }
+    if(bdf_count == 0 || ascent + descent <= 0 || ascent + descent > 255)
+        {
+        fprintf(stderr, "Bad BDF '%s'\n", fname);
+        exit(1);
+        }
+    src_height = ascent + descent;
+    src_baseline = ascent;
+    src_load = load_bdf;
+}
+
+#ifdef USE_FREETYPE
+
+// TTF / OTF, rasterized at the pixel size. Grey for AA, else mono.
+
+static FT_Face face;
+
+static int  load_ttf(unsigned int code)
+
+{
+    memset(pix, 0, sizeof(pix));
+    
+    if(FT_Get_Char_Index(face, code) == 0)
+        return -1;
+    if(FT_Load_Char(face, code, FT_LOAD_RENDER | 
+                    (pix_max == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_DEFAULT)))
+        return -1;
+        
+    FT_GlyphSlot gs = face->glyph;
+    FT_Bitmap *bm = &gs->bitmap;
+    for(int yy = 0; yy < (int)bm->rows; yy++)
+        for(int xx = 0; xx < (int)bm->width; xx++)
+            {
+            int py = src_baseline - gs->bitmap_top + yy;
+            int px = MARGIN + gs->bitmap_left + xx;
+            const unsigned char *row = bm->buffer + yy * bm->pitch;
+            if(py < 0 || py >= 256 || px < 0 || px >= 256)
+                continue;
+            if(bm->pixel_mode == FT_PIXEL_MODE_MONO)
+                pix[py][px] = get_bit(row, xx);
+            else
+                pix[py][px] = pix_max == 1 ? row[xx] >= 128 : row[xx];
+            }
+    return (gs->advance.x + 32) >> 6;
+}
+
+static void open_ttf(const char *fname, int size)
+
+{
+    FT_Library lib;
+    
+    if(size < 4 || size > 200)
+        {
+        fprintf(stderr, "Bad size %d\n", size);
+        exit(1);
+        }
+    if(FT_Init_FreeType(&lib) || FT_New_Face(lib, fname, 0, &face) ||
+                                    FT_Set_Pixel_Sizes(face, 0, size))
+        {
+        fprintf(stderr, "Cannot load '%s'\n", fname);
+        exit(1);
+        }
+    src_baseline = (face->size->metrics.ascender + 63) >> 6;
+    src_height = src_baseline + ((-face->size->metrics.descender + 63) >> 6);
+    src_load = load_ttf;
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Code point set, "0x20-0x7e,0xb0" or the characters of a UTF-8 string
+
+static unsigned char want[MAX_CODE];
+
+static void want_range(const char *spec)
+
+{
+    while(*spec)
+        {
+        char *end;
+        unsigned long from = strtoul(spec, &end, 0), to = from;
+        if(end == spec)
+            break;
+        if(*end == '-')
+            to = strtoul(end + 1, &end, 0);
+        for(unsigned long code = from; code <= to && code < MAX_CODE; code++)
+            want[code] = 1;
+        spec = *end == ',' ? end + 1 : end;
+        }
+    if(*spec)
+        {
+        fprintf(stderr, "Bad code points at '%s'\n", spec);
+        exit(1);
+        }
+}
+
+static void want_text(const char *text)
+
+{
+    const unsigned char *ptr = (const unsigned char *)text;
+    
+    while(*ptr)
+        {
+        unsigned int code = *ptr++;
+        int more = code >= 0xF0 ? 3 : code >= 0xE0 ? 2 : code >= 0xC0 ? 1 : 0;
+        if(more)
+            code &= 0x3F >> more;
+        for(; more && (*ptr & 0xC0) == 0x80; more--)
+            code = (code << 6) | (*ptr++ & 0x3F);
+        if(code < MAX_CODE)
+            want[code] = 1;
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Any source, any layout
+
+#define OUT_FIXED   0
+#define OUT_PACKED  1
+#define OUT_AA      2
+
+static unsigned char widths[MAX_GLYPHS];
+static int  offsets[MAX_GLYPHS];
+static tft_font_range_t ranges[MAX_GLYPHS];
+
+// Cell rows, MSB left, bytes per row from the width
+
+static void fixed_glyph(int idx, int advance, int height)
+
+{
+    int width = advance > 255 ? 255 : advance;
+    
+    widths[idx] = width;
+    offsets[idx] = outbits / 8;
+    for(int yy = 0; yy < height; yy++)
+        {
+        for(int xx = 0; xx < width; xx++)
+            put_bits(pix[yy][MARGIN + xx] != 0, 1);
+        outbits = (outbits + 7) & ~7;
+        }
+}
+
+// Runs of consecutive code points
+
+static int  make_ranges(int count)
+
+{
+    int nn = 0;
+    
+    for(int loop = 0; loop < count; loop++)
+        {
+        if(nn && ranges[nn - 1].first + ranges[nn - 1].count == codes[loop])
+            ranges[nn - 1].count++;
+        else
+            {
+            ranges[nn].first = codes[loop];
+            ranges[nn].count = 1;
+            ranges[nn].index = loop;
+            nn++;
+            }
+        }
+    return nn;
+}
+
+static void print_fixed(const char *name, int count, int height)
+
+{
+    char buf[128];
+    
+    printf("const unsigned char widtbl_%s[%d] =         // character width table\n{\n", 
+                                                                name, count);
+    for(int loop = 0; loop < count; loop += 8)
+        {
+        int len = snprintf(buf, sizeof(buf), "       ");
+        int last = MIN(loop + 8, count);
+        for(int loop2 = loop; loop2 < last; loop2++)
+            len += snprintf(buf + len, sizeof(buf) - len, " %d%s", widths[loop2], 
+                                                loop2 < count - 1 ? "," : "");
+        printf("%-44s// char %u - %u\n", buf, codes[loop], codes[last - 1]);
+        }
+    printf("};\n\n// Row format, MSB left\n\n");
+    
+    for(int loop = 0; loop < count; loop++)
+        {
+        int bytes = (widths[loop] + 7) / 8, size = MAX(bytes, 1) * height;
+        int per = bytes > 1 ? 12 / bytes : 11;
+        
+        printf("const unsigned char chr_%s_%02X[%d] =         // %d unsigned char%s per row\n{\n",
+                        name, codes[loop], size, bytes, bytes == 1 ? "" : "s");
+        for(int row = 0; row < height; row += per)
+            {
+            int len = snprintf(buf, sizeof(buf), "       ");
+            int last = MIN(row + per, height);
+            for(int yy = row; yy < last; yy++)
+                for(int xx = 0; xx < MAX(bytes, 1); xx++)
+                    len += snprintf(buf + len, sizeof(buf) - len, " 0x%02X%s", 
+                                    bytes ? out[offsets[loop] + yy * bytes + xx] : 0,
+                                        yy < height - 1 || xx < bytes - 1 ? "," : "");
+            printf("%-80s// row %d - %d\n", buf, row + 1, last);
+            }
+        printf("};\n");
+        }
+    printf("\nconst unsigned char* chrtbl_%s[%d] =       // character pointer table\n{", 
+                                                                name, count);
+    for(int loop = 0; loop < count; loop++)
+        printf("%schr_%s_%02X%s", loop % 8 ? " " : "\n        ", name, codes[loop],
+                                                loop < count - 1 ? "," : "");
+    printf("\n};\n\n");
+}
+
+static int  make_font(int fmt, int bpp, int factor, int gap, const char *name, 
+                            const char *id)
+
+{
+    int count = 0, missing = 0, levels = 1 << bpp;
+    int height = src_height, baseline = src_baseline, pad = 0;
+    char tab[64];
+    
+    if(fmt == OUT_AA)
+        {
+        pad = (factor - src_baseline % factor) % factor;
+        height = (src_height + pad + factor - 1) / factor;
+        baseline = (src_baseline + pad) / factor;
+        }
+    for(unsigned int code = 0; code < MAX_CODE; code++)
+        {
+        if(!want[code])
+            continue;
+        int advance = src_load(code);
+        if(advance < 0)
+            {
+            missing++;
+            continue;
+            }
+        if(count == MAX_GLYPHS)
+            {
+            fprintf(stderr, "Over %d glyphs\n", MAX_GLYPHS);
+            exit(1);
+            }
+        codes[count] = code;
+        if(fmt == OUT_FIXED)
+            fixed_glyph(count, advance, height);
+        else if(fmt == OUT_AA)
+            {
+            shrink(factor, levels, src_baseline);
+            emit_glyph(count, (advance + factor / 2) / factor, baseline, height, bpp);
+            }
+        else
+            emit_glyph(count, advance, baseline, height, 1);
+        count++;
+        }
+    if(count == 0)
+        {
+        fprintf(stderr, "No glyphs\n");
+        exit(1);
+        }
+    int nranges = make_ranges(count);
+    if(nranges == 1)
+        nranges = 0;
+        
+    // Target sizes, 4 byte pointers
+    int size = outbits / 8 + nranges * sizeof(tft_font_range_t);
+    if(fmt == OUT_FIXED)
+        size += count + count * 4;
+    else
+        size += count * sizeof(tft_gfx_glyph_t);
+    fprintf(stderr, "Font %s: %d glyphs (%d missing), %d ranges, %d rows, "
+                    "%d bytes flash\n", name, count, missing, nranges, height, size);
+                    
+    printf("// Font %s, %d rows, %s. Generated by tools/fontgen, do not edit.\n\n",
+                name, height, fmt == OUT_FIXED ? "fixed cells" : 
+                    fmt == OUT_PACKED ? "bounding box packed" : "anti aliased");
+    printf("#include <stdlib.h>\n\n#include \"tft_fonts.h\"\n\n");
+    
+    snprintf(tab, sizeof(tab), "font_%s", name);
+    if(fmt == OUT_FIXED)
+        print_fixed(name, count, height);
+    else
+        print_tables(tab, count);
+        
+    if(nranges)
+        {
+        printf("const tft_font_range_t %s_ranges[%d] = \n{\n", tab, nranges);
+        for(int loop = 0; loop < nranges; loop++)
+            printf("    { 0x%04X, %3d, %3d },\n", ranges[loop].first, 
+                                ranges[loop].count, ranges[loop].index);
+        printf("};\n\n");
+        }
+    printf("const tft_font_t tft_font_%s = \n{\n", name);
+    if(fmt == OUT_FIXED)
+        printf("    .id = %s, .chrtbl = chrtbl_%s, .widtbl = widtbl_%s,\n"
+               "    .first = %u, .count = %d, .height = %d,\n"
+               "    .gap = %d, .scale = 1, .format = TFT_FONT_FMT_FIXED", 
+                        id, name, name, codes[0], count, height, gap);
+    else
+        printf("    .id = %s, .first = %u, .count = %d, .height = %d,\n"
+               "    .gap = %d, .scale = 1, .format = %s,\n"
+               "    .bitmap = %s_bits, .glyphs = %s_glyphs,\n"
+               "    .baseline = %d, .bpp = %d", 
+                        id, codes[0], count, height, gap, 
+                            fmt == OUT_AA ? "TFT_FONT_FMT_AA" : "TFT_FONT_FMT_GFX",
+                                tab, tab, baseline, fmt == OUT_AA ? bpp : 0);
+    if(nranges)
+        printf(",\n    .ranges = %s_ranges, .nranges = %d", tab, nranges);
+    printf("\n};\n\n// EOF\n");
+    return 0;
+}
+
+static void usage()
+
+{
+    fprintf(stderr, 
+        "Usage: fontgen -bdf file | -ttf file -size px | -font 32|64|sans24\n"
+        "               [-chars 0x20-0x7e,..] [-text string]\n"
+        "               [-fmt fixed|packed|gfx|aa] [-bpp 2|4] [-factor n]\n"
+        "               [-gap n] [-id TFT_FONT_X] -name name\n"
+        "       fontgen 32|64\n"
+        "       fontgen -aa bpp factor 32|64|sans24 name\n");
+    exit(1);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int     main(int argc, char *argv[])
+
+{
+    const char *bdf = NULL, *ttf = NULL, *tree = NULL, *name = NULL, *id = NULL;
+    int size = 0, fmt = OUT_FIXED, bpp = 4, factor = 1, gap = -1, chars = false;
+    char idbuf[64];
+    
+    if(argc == 6 && strcmp(argv[1], "-aa") == 0)
+        return make_aa(atoi(argv[2]), atoi(argv[3]), argv[4], argv[5]);
+        
+    if(argc == 2 && isdigit((unsigned char)argv[1][0]))
+        return make_packed(atoi(argv[1]));
+        
+    for(int loop = 1; loop < argc; loop++)
+        {
+        const char *opt = argv[loop], *arg = argv[loop + 1];
+        if(loop == argc - 1)
+            usage();
+        loop++;
+        if(strcmp(opt, "-bdf") == 0)
+            bdf = arg;
+        else if(strcmp(opt, "-ttf") == 0)
+            ttf = arg;
+        else if(strcmp(opt, "-font") == 0)
+            tree = arg;
+        else if(strcmp(opt, "-size") == 0)
+            size = atoi(arg);
+        else if(strcmp(opt, "-chars") == 0)
+            { want_range(arg); chars = true; }
+        else if(strcmp(opt, "-text") == 0)
+            { want_text(arg); chars = true; }
+        else if(strcmp(opt, "-bpp") == 0)
+            bpp = atoi(arg);
+        else if(strcmp(opt, "-factor") == 0)
+            factor = atoi(arg);
+        else if(strcmp(opt, "-gap") == 0)
+            gap = atoi(arg);
+        else if(strcmp(opt, "-name") == 0)
+            name = arg;
+        else if(strcmp(opt, "-id") == 0)
+            id = arg;
+        else if(strcmp(opt, "-fmt") == 0)
+            {
+            if(strcmp(arg, "fixed") == 0)
+                fmt = OUT_FIXED;
+            else if(strcmp(arg, "packed") == 0 || strcmp(arg, "gfx") == 0)
+                fmt = OUT_PACKED;
+            else if(strcmp(arg, "aa") == 0)
+                fmt = OUT_AA;
+            else
+                usage();
+            }
+        else
+            usage();
+        }
+    if(name == NULL || (bdf != NULL) + (ttf != NULL) + (tree != NULL) != 1)
+        usage();
+    if(fmt == OUT_AA && ((bpp != 2 && bpp != 4) || factor < 1 || factor > 4))
+        {
+        fprintf(stderr, "Bad bpp %d or factor %d\n", bpp, factor);
+        exit(1);
+        }
+    if(fmt != OUT_AA)
+        factor = 1;
+    if(size && ttf == NULL)
+        fprintf(stderr, "-size ignored, BDF and tree fonts keep their size\n");
+        
+    if(tree)
+        open_tree(tree);
+    else if(bdf)
+        open_bdf(bdf);
+    else
+        {
+#ifdef USE_FREETYPE
+        // Grey only if it is kept, one sample per pixel
+        if(fmt == OUT_AA && factor == 1)
+            pix_max = 255;
+        open_ttf(ttf, size * factor);
+#else
+        fprintf(stderr, "TTF input needs a build with -DUSE_FREETYPE\n");
+        exit(1);
+#endif
+        }
+    if(!chars)
+        want_range("0x20-0x7e");
+    if(gap < 0)
+        gap = tree ? tree_font->gap : 0;
+    if(id == NULL)
+        {
+        int len = snprintf(idbuf, sizeof(idbuf), "TFT_FONT_");
+        for(int loop = 0; name[loop] && len < (int)sizeof(idbuf) - 1; loop++)
+            idbuf[len++] = toupper((unsigned char)name[loop]);
+        idbuf[len] = '\0';
+        id = idbuf;
+        }
+    return make_font(fmt, bpp, factor, gap, name, id);
+}
+
+// EOF
@@ -0,0 +1,6 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, the handle only. Nothing goes out on a bus.
+
+typedef void *spi_device_handle_t;
+
+// EOF
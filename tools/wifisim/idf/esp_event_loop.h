@@ -0,0 +1,11 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in. The handler is kept, events are posted by the
+// simulated driver.
+
+#include "esp_wifi.h"
+
+typedef esp_err_t (*system_event_cb_t)(void *ctx, system_event_t *event);
+
+esp_err_t esp_event_loop_init(system_event_cb_t cb, void *ctx);
+
+// EOF
@@ -0,0 +1,11 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, info lines only with -v
+
+void wifisim_log(int always, const char *tag, const char *fmt, ...);
+
+#define ESP_LOGE(tag, fmt, ...)     wifisim_log(true, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...)     wifisim_log(true, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...)     wifisim_log(false, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...)     wifisim_log(false, tag, fmt, ##__VA_ARGS__)
+
+// EOF
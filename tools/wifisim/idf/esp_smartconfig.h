@@ -0,0 +1,8 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, never started
+
+const char *esp_smartconfig_get_version(void);
+esp_err_t esp_smartconfig_stop(void);
+esp_err_t esp_esptouch_set_timeout(uint8_t time_s);
+
+// EOF
@@ -0,0 +1,34 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, errors and heap
+
+#ifndef WIFISIM_ESP_SYSTEM_H
+#define WIFISIM_ESP_SYSTEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK                      0
+#define ESP_FAIL                    -1
+#define ESP_ERR_NO_MEM              0x101
+#define ESP_ERR_INVALID_ARG         0x102
+#define ESP_ERR_INVALID_STATE       0x103
+#define ESP_ERR_NVS_NOT_FOUND       0x1102
+
+#define ESP_ERROR_CHECK(xx)         (void)(xx)
+
+#define MALLOC_CAP_DMA              (1 << 3)
+#define MALLOC_CAP_8BIT             (1 << 2)
+#define MALLOC_CAP_INTERNAL         (1 << 11)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+
+// Not in libc
+char *itoa(int value, char *str, int base);
+
+#endif
+
+// EOF
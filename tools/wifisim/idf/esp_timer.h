@@ -0,0 +1,6 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, microseconds of simulated time
+
+int64_t esp_timer_get_time(void);
+
+// EOF
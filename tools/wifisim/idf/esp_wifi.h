@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, the esp_wifi types and calls wifi.c uses. The scan
+// calls replay a trace, see wifisim.c. The rest do nothing and
+// return ESP_OK.
+
+#ifndef WIFISIM_ESP_WIFI_H
+#define WIFISIM_ESP_WIFI_H
+
+#include "esp_system.h"
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+    WIFI_AUTH_MAX
+} wifi_auth_mode_t;
+
+typedef enum {
+    WIFI_SECOND_CHAN_NONE = 0,
+    WIFI_SECOND_CHAN_ABOVE,
+    WIFI_SECOND_CHAN_BELOW,
+} wifi_second_chan_t;
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    wifi_second_chan_t second;
+    int8_t  rssi;
+    wifi_auth_mode_t authmode;
+} wifi_ap_record_t;
+
+typedef enum {
+    WIFI_SCAN_TYPE_ACTIVE = 0,
+    WIFI_SCAN_TYPE_PASSIVE,
+} wifi_scan_type_t;
+
+typedef struct {
+    uint32_t min;                       // ms per channel
+    uint32_t max;
+} wifi_active_scan_time_t;
+
+typedef union {
+    wifi_active_scan_time_t active;
+    uint32_t passive;
+} wifi_scan_time_t;
+
+typedef struct {
+    uint8_t *ssid;
+    uint8_t *bssid;
+    uint8_t channel;                    // 0 for all
+    bool show_hidden;
+    wifi_scan_type_t scan_type;
+    wifi_scan_time_t scan_time;
+} wifi_scan_config_t;
+
+typedef enum { WIFI_FAST_SCAN = 0, WIFI_ALL_CHANNEL_SCAN } wifi_scan_method_t;
+typedef enum { WIFI_CONNECT_AP_BY_SIGNAL = 0, WIFI_CONNECT_AP_BY_SECURITY } wifi_sort_method_t;
+
+typedef struct {
+    int8_t rssi;
+    wifi_auth_mode_t authmode;
+} wifi_scan_threshold_t;
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    wifi_scan_method_t scan_method;
+    wifi_sort_method_t sort_method;
+    wifi_scan_threshold_t threshold;
+} wifi_sta_config_t;
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    uint8_t ssid_len;
+    uint8_t channel;
+    wifi_auth_mode_t authmode;
+    uint8_t ssid_hidden;
+    uint8_t max_connection;
+    uint16_t beacon_interval;
+} wifi_ap_config_t;
+
+typedef union {
+    wifi_ap_config_t  ap;
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+typedef struct { int nvs_enable; } wifi_init_config_t;
+
+#define WIFI_INIT_CONFIG_DEFAULT()  { .nvs_enable = 0 }
+
+typedef enum { ESP_IF_WIFI_STA = 0, ESP_IF_WIFI_AP } esp_interface_t;
+typedef enum { WIFI_MODE_NULL = 0, WIFI_MODE_STA, WIFI_MODE_AP, WIFI_MODE_APSTA } wifi_mode_t;
+typedef enum { WIFI_PS_NONE = 0, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+
+typedef enum {
+    SYSTEM_EVENT_WIFI_READY = 0,
+    SYSTEM_EVENT_SCAN_DONE,
+    SYSTEM_EVENT_STA_START,
+    SYSTEM_EVENT_STA_STOP,
+    SYSTEM_EVENT_STA_CONNECTED,
+    SYSTEM_EVENT_STA_DISCONNECTED,
+    SYSTEM_EVENT_STA_AUTHMODE_CHANGE,
+    SYSTEM_EVENT_STA_GOT_IP,
+    SYSTEM_EVENT_STA_LOST_IP,
+    SYSTEM_EVENT_STA_WPS_ER_SUCCESS,
+    SYSTEM_EVENT_STA_WPS_ER_FAILED,
+    SYSTEM_EVENT_STA_WPS_ER_TIMEOUT,
+    SYSTEM_EVENT_STA_WPS_ER_PIN,
+    SYSTEM_EVENT_AP_START,
+    SYSTEM_EVENT_AP_STOP,
+    SYSTEM_EVENT_AP_STACONNECTED,
+    SYSTEM_EVENT_AP_STADISCONNECTED,
+    SYSTEM_EVENT_MAX
+} system_event_id_t;
+
+typedef struct {
+    uint32_t status;                    // 0 done, 1 failed
+    uint8_t  number;                    // Records found
+    uint8_t  scan_id;
+} system_event_sta_scan_done_t;
+
+typedef struct {
+    uint8_t pin_code[8];
+} system_event_sta_wps_er_pin_t;
+
+typedef union {
+    system_event_sta_scan_done_t  scan_done;
+    system_event_sta_wps_er_pin_t sta_er_pin;
+} system_event_info_t;
+
+typedef struct {
+    system_event_id_t   event_id;
+    system_event_info_t event_info;
+} system_event_t;
+
+// Scans, from the trace
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block);
+esp_err_t esp_wifi_scan_stop(void);
+esp_err_t esp_wifi_scan_get_ap_num(uint16_t *number);
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *recs);
+
+// No radio
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config);
+esp_err_t esp_wifi_deinit(void);
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode);
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type);
+esp_err_t esp_wifi_set_config(esp_interface_t iface, wifi_config_t *config);
+esp_err_t esp_wifi_get_mac(esp_interface_t iface, uint8_t mac[6]);
+esp_err_t esp_wifi_start(void);
+esp_err_t esp_wifi_stop(void);
+esp_err_t esp_wifi_connect(void);
+esp_err_t esp_wifi_disconnect(void);
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *info);
+
+#endif
+
+// EOF
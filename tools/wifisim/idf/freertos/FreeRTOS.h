@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, FreeRTOS on pthreads. See wifisim.c.
+
+#ifndef WIFISIM_FREERTOS_H
+#define WIFISIM_FREERTOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+// The same as CONFIG_FREERTOS_HZ=100 in sdkconfig
+
+#define portTICK_PERIOD_MS  10
+#define portTICK_RATE_MS    portTICK_PERIOD_MS
+#define portMAX_DELAY       0xffffffff
+#define pdMS_TO_TICKS(ms)   ((ms) / portTICK_PERIOD_MS)
+
+#define pdTRUE      1
+#define pdFALSE     0
+#define pdPASS      1
+
+#define BIT0    0x00000001
+#define BIT1    0x00000002
+#define BIT2    0x00000004
+#define BIT3    0x00000008
+#define BIT4    0x00000010
+#define BIT5    0x00000020
+#define BIT6    0x00000040
+#define BIT7    0x00000080
+#define BIT8    0x00000100
+#define BIT9    0x00000200
+#define BIT10   0x00000400
+#define BIT11   0x00000800
+#define BIT12   0x00001000
+#define BIT13   0x00002000
+#define BIT14   0x00004000
+#define BIT15   0x00008000
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif
+
+// EOF
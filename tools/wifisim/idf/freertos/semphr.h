@@ -0,0 +1,12 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, binary semaphores
+
+SemaphoreHandle_t wifisim_sema_create(int given);
+
+#define vSemaphoreCreateBinary(sema)    ((sema) = wifisim_sema_create(true))
+#define xSemaphoreCreateBinary()        wifisim_sema_create(false)
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sema, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sema);
+
+// EOF
@@ -0,0 +1,15 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, tasks are threads. Priorities and stack sizes are
+// ignored. Ticks run at the simulator's speed.
+
+#include <sched.h>
+
+BaseType_t xTaskCreate(void (*func)(void *), const char *name, uint32_t stack,
+                            void *parm, UBaseType_t prio, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+
+#define taskYIELD()     sched_yield()
+
+// EOF
@@ -0,0 +1,6 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, lwip's error type
+
+typedef int8_t err_t;
+
+// EOF
@@ -0,0 +1,4 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, nothing used
+
+// EOF
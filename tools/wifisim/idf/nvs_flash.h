@@ -0,0 +1,20 @@
+//////////////////////////////////////////////////////////////////////////
+// Host stand-in, NVS kept in memory for the run
+
+typedef uint32_t nvs_handle;
+
+#define NVS_READONLY    0
+#define NVS_READWRITE   1
+
+esp_err_t nvs_open(const char *name, int mode, nvs_handle *handle);
+void      nvs_close(nvs_handle handle);
+esp_err_t nvs_commit(nvs_handle handle);
+
+esp_err_t nvs_get_str(nvs_handle handle, const char *key, char *out, unsigned int *len);
+esp_err_t nvs_set_str(nvs_handle handle, const char *key, const char *value);
+esp_err_t nvs_get_u8(nvs_handle handle, const char *key, uint8_t *out);
+esp_err_t nvs_set_u8(nvs_handle handle, const char *key, uint8_t value);
+esp_err_t nvs_get_blob(nvs_handle handle, const char *key, void *out, size_t *len);
+esp_err_t nvs_set_blob(nvs_handle handle, const char *key, const void *value, size_t len);
+
+// EOF
@@ -0,0 +1,1385 @@
+//////////////////////////////////////////////////////////////////////////
+// WiFi scan simulator. Compiles on linux.
+//
+// Runs the scan side of main/ on a PC: wifi.c, the AP table, views,
+// scan profiles and the scheduler, unchanged, over stand-ins for
+// FreeRTOS, NVS and esp_wifi (idf/). Scans replay a trace, so the same
+// site can be run again and again while tuning the scheduler or the
+// table size.
+//
+// esp_wifi_scan_start() waits out the channel's dwell as the scan
+// profile sets it, plus a channel switch. Active scans stay the maximum
+// on channels where the trace has APs, the minimum on empty ones,
+// passive scans the passive time. Then SYSTEM_EVENT_SCAN_DONE goes to
+// the handler wifi.c registered, and esp_wifi_scan_get_ap_num() /
+// esp_wifi_scan_get_ap_records() hand out the channel's records from
+// the trace's current sweep, the fetch frees them like the driver does.
+// A sweep of the trace ends when wifi.c goes back to a lower channel,
+// after the last one the trace starts over.
+//
+// Traces are CSV, one AP sighting a line, auth is wifi_auth_mode_t:
+//
+//   sweep,bssid,ssid,channel,rssi,auth
+//   0,a4:2b:b0:11:22:33,Home Net,6,-52,3
+//
+// SSIDs may hold commas, the fields are taken from both ends. Lines
+// starting with # are comments. Synthetic traces (-synth) put most APs
+// on 1, 6 and 11, walk the RSSI, drop weak APs from some sweeps and
+// take a few percent away for a while (-churn).
+//
+// A render task, as in tft_sniff.c, takes each snapshot, sorts it with
+// ap_view and draws the AP rows with tft_label and tft_num into a frame
+// buffer in memory. Per snapshot it measures in real time:
+//
+//   table    SCAN_DONE to the snapshot of the merged table in hand
+//   view     ap_view_update()
+//   rows     the AP rows drawn
+//
+// Build from this directory:
+//
+//   gcc -O2 -Iidf -I../../main -o wifisim wifisim.c ../../main/wifi.c
+//          ../../main/ap_table.c ../../main/ap_view.c ../../main/ap_chan.c
+//          ../../main/scan_prof.c ../../main/scan_sched.c
+//          ../../main/tft_label.c ../../main/tft_num.c
+//          ../../main/tft_layout.c ../../main/tft_fonts.c
+//          ../../main/tft_expand.c ../../main/tft_gcache.c
+//          ../../main/tft_blend.c ../../main/Font*.c -lpthread
+//
+// Examples:
+//
+//   ./wifisim -synth 40 -sweeps 100 -dump > office.csv
+//   ./wifisim -trace office.csv -sweeps 20
+//   ./wifisim -trace office.csv -prof fast -speed 10 -poll 100
+//   ./wifisim -bench
+//   ./wifisim -check
+//
+// -speed runs simulated time (dwell, idle, ticks) that many times
+// faster, the latencies are real time on this machine. -poll N makes
+// the render task poll every N ms like RENDER_MS in tft_sniff.c, else
+// it wakes on SLICED_BIT. The poll wait is simulated time, it shrinks
+// with -speed. -bench replays synthetic traces of 10, 100 and 500 APs,
+// each in a process of its own, one line each. -check takes every dB
+// through ap_chan's power table and back, exit status 1 if one is off.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_system.h"
+#include "esp_wifi.h"
+#include "esp_event_loop.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+#include "esp_smartconfig.h"
+#include "esp_wps.h"
+#include "driver/spi_master.h"
+
+#include "ap_chan.h"
+#include "ap_table.h"
+#include "wifi.h"
+#include "ap_view.h"
+#include "scan_prof.h"
+#include "tft_base.h"
+#include "tft_fonts.h"
+#include "tft_gcache.h"
+#include "tft_layout.h"
+#include "tft_label.h"
+#include "tft_num.h"
+
+#define SIM_HOP_MS      5           // Channel switch, per scan
+#define SIM_ACTIVE_MS   120         // Driver defaults for zero times
+#define SIM_PASSIVE_MS  360
+#define NVS_KEYS        16
+#define NVS_LEN         256
+#define AP_ROWS         10          // As tft_sniff.c
+
+static const char *TAG = "WiFiSim";
+
+static double  speed = 1;
+static int64_t real_start;
+static int     verbose = false;
+
+//////////////////////////////////////////////////////////////////////////
+// Clock. Simulated time runs speed times real time.
+
+static int64_t real_us()
+
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+int64_t esp_timer_get_time(void)
+
+{
+    return (int64_t)((real_us() - real_start) * speed);
+}
+
+static void sim_sleep(int64_t sim_us)
+
+{
+    int64_t us = (int64_t)(sim_us / speed);
+    struct timespec ts = { us / 1000000, (us % 1000000) * 1000 };
+    while(nanosleep(&ts, &ts) != 0)
+        ;
+}
+
+// Real time deadline, ticks of simulated time from now
+
+static void sim_deadline(struct timespec *ts, TickType_t ticks)
+
+{
+    int64_t us = (int64_t)(ticks * portTICK_PERIOD_MS * 1000LL / speed);
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    us += ts->tv_nsec / 1000;
+    ts->tv_sec += us / 1000000;
+    ts->tv_nsec = (us % 1000000) * 1000;
+}
+
+static void sim_cond_init(pthread_cond_t *cond)
+
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+// Wait on the condition, false at the deadline. Called locked.
+
+static int  sim_wait(pthread_cond_t *cond, pthread_mutex_t *lock,
+                            TickType_t ticks, const struct timespec *ts)
+
+{
+    if(ticks == portMAX_DELAY)
+        return pthread_cond_wait(cond, lock) == 0;
+    return pthread_cond_timedwait(cond, lock, ts) == 0;
+}
+
+void wifisim_log(int always, const char *tag, const char *fmt, ...)
+
+{
+    va_list ap;
+
+    if(!always && !verbose)
+        return;
+    fprintf(stderr, "(%lld) %s: ", (long long)(esp_timer_get_time() / 1000), tag);
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fprintf(stderr, "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FreeRTOS on pthreads
+
+typedef struct _sim_task_t
+
+{
+    void (*func)(void *);
+    void *parm;
+
+} sim_task_t;
+
+typedef struct _sim_sema_t
+
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int given;
+
+} sim_sema_t;
+
+typedef struct _sim_group_t
+
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+
+} sim_group_t;
+
+static void *task_entry(void *arg)
+
+{
+    sim_task_t task = *(sim_task_t *)arg;
+    free(arg);
+    task.func(task.parm);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(void (*func)(void *), const char *name, uint32_t stack,
+                            void *parm, UBaseType_t prio, TaskHandle_t *handle)
+
+{
+    pthread_t thread;
+    sim_task_t *task = malloc(sizeof(sim_task_t));
+
+    if(task == NULL)
+        return pdFALSE;
+    task->func = func; task->parm = parm;
+    if(pthread_create(&thread, NULL, task_entry, task) != 0)
+        {
+        free(task);
+        return pdFALSE;
+        }
+    pthread_detach(thread);
+    if(handle != NULL)
+        *handle = (TaskHandle_t)thread;
+    return pdPASS;
+}
+
+// Only a task deleting itself
+
+void vTaskDelete(TaskHandle_t task)
+
+{
+    if(task == NULL)
+        pthread_exit(NULL);
+    ESP_LOGE(TAG, "vTaskDelete() of another task ignored");
+}
+
+void vTaskDelay(TickType_t ticks)
+
+{
+    sim_sleep(ticks * portTICK_PERIOD_MS * 1000LL);
+}
+
+TickType_t xTaskGetTickCount(void)
+
+{
+    return (TickType_t)(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+SemaphoreHandle_t wifisim_sema_create(int given)
+
+{
+    sim_sema_t *sema = calloc(1, sizeof(sim_sema_t));
+
+    if(sema == NULL)
+        return NULL;
+    pthread_mutex_init(&sema->lock, NULL);
+    sim_cond_init(&sema->cond);
+    sema->given = given;
+    return sema;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks)
+
+{
+    sim_sema_t *sema = handle;
+    struct timespec ts;
+    int ret = pdTRUE;
+
+    sim_deadline(&ts, ticks);
+    pthread_mutex_lock(&sema->lock);
+    while(!sema->given && ret)
+        ret = sim_wait(&sema->cond, &sema->lock, ticks, &ts);
+    if(sema->given)
+        {
+        sema->given = false;
+        ret = pdTRUE;
+        }
+    pthread_mutex_unlock(&sema->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+
+{
+    sim_sema_t *sema = handle;
+    int ret;
+
+    pthread_mutex_lock(&sema->lock);
+    ret = !sema->given;
+    sema->given = true;
+    pthread_cond_signal(&sema->cond);
+    pthread_mutex_unlock(&sema->lock);
+    return ret;
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+
+{
+    sim_group_t *group = calloc(1, sizeof(sim_group_t));
+
+    if(group == NULL)
+        return NULL;
+    pthread_mutex_init(&group->lock, NULL);
+    sim_cond_init(&group->cond);
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t handle, EventBits_t bits)
+
+{
+    sim_group_t *group = handle;
+
+    pthread_mutex_lock(&group->lock);
+    bits = group->bits |= bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return bits;
+}
+
+// Returns the bits before clearing, as FreeRTOS does
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t handle, EventBits_t bits)
+
+{
+    sim_group_t *group = handle;
+    EventBits_t old;
+
+    pthread_mutex_lock(&group->lock);
+    old = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return old;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t handle)
+
+{
+    sim_group_t *group = handle;
+    EventBits_t bits;
+
+    pthread_mutex_lock(&group->lock);
+    bits = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return bits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t handle, EventBits_t bits,
+                    BaseType_t clear, BaseType_t all, TickType_t ticks)
+
+{
+    sim_group_t *group = handle;
+    struct timespec ts;
+    EventBits_t got;
+    int waiting = true;
+
+    sim_deadline(&ts, ticks);
+    pthread_mutex_lock(&group->lock);
+    while(true)
+        {
+        got = group->bits;
+        int met = all ? (got & bits) == bits : (got & bits) != 0;
+        if(met)
+            {
+            if(clear)
+                group->bits &= ~bits;
+            break;
+            }
+        if(!waiting || ticks == 0)
+            break;
+        waiting = sim_wait(&group->cond, &group->lock, ticks, &ts);
+        }
+    pthread_mutex_unlock(&group->lock);
+    return got;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NVS, in memory for the run
+
+typedef struct _nvs_key_t
+
+{
+    char key[16];
+    uint8_t data[NVS_LEN];
+    size_t len;
+
+} nvs_key_t;
+
+static nvs_key_t nvs_keys[NVS_KEYS];
+static int nvs_count = 0;
+static pthread_mutex_t nvs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static nvs_key_t *nvs_find(const char *key, int make)
+
+{
+    for(int loop = 0; loop < nvs_count; loop++)
+        {
+        if(strcmp(nvs_keys[loop].key, key) == 0)
+            return &nvs_keys[loop];
+        }
+    if(!make || nvs_count >= NVS_KEYS || strlen(key) >= sizeof(nvs_keys[0].key))
+        return NULL;
+    nvs_key_t *kk = &nvs_keys[nvs_count++];
+    strcpy(kk->key, key);
+    kk->len = 0;
+    return kk;
+}
+
+static esp_err_t nvs_get(const char *key, void *out, size_t *len)
+
+{
+    esp_err_t err = ESP_OK;
+
+    pthread_mutex_lock(&nvs_lock);
+    nvs_key_t *kk = nvs_find(key, false);
+    if(kk == NULL)
+        err = ESP_ERR_NVS_NOT_FOUND;
+    else if(out != NULL && *len < kk->len)
+        err = ESP_ERR_INVALID_ARG;
+    else
+        {
+        if(out != NULL)
+            memcpy(out, kk->data, kk->len);
+        *len = kk->len;
+        }
+    pthread_mutex_unlock(&nvs_lock);
+    return err;
+}
+
+static esp_err_t nvs_set(const char *key, const void *value, size_t len)
+
+{
+    esp_err_t err = ESP_OK;
+
+    pthread_mutex_lock(&nvs_lock);
+    nvs_key_t *kk = nvs_find(key, true);
+    if(kk == NULL || len > NVS_LEN)
+        err = ESP_ERR_NO_MEM;
+    else
+        {
+        memcpy(kk->data, value, len);
+        kk->len = len;
+        }
+    pthread_mutex_unlock(&nvs_lock);
+    return err;
+}
+
+esp_err_t nvs_open(const char *name, int mode, nvs_handle *handle)
+
+{
+    *handle = 1;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle handle)
+
+{
+}
+
+esp_err_t nvs_commit(nvs_handle handle)
+
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_str(nvs_handle handle, const char *key, char *out, unsigned int *len)
+
+{
+    size_t slen = *len;
+    esp_err_t err = nvs_get(key, out, &slen);
+    *len = slen;
+    return err;
+}
+
+esp_err_t nvs_set_str(nvs_handle handle, const char *key, const char *value)
+
+{
+    return nvs_set(key, value, strlen(value) + 1);
+}
+
+esp_err_t nvs_get_u8(nvs_handle handle, const char *key, uint8_t *out)
+
+{
+    size_t len = sizeof(*out);
+    return nvs_get(key, out, &len);
+}
+
+esp_err_t nvs_set_u8(nvs_handle handle, const char *key, uint8_t value)
+
+{
+    return nvs_set(key, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_blob(nvs_handle handle, const char *key, void *out, size_t *len)
+
+{
+    return nvs_get(key, out, len);
+}
+
+esp_err_t nvs_set_blob(nvs_handle handle, const char *key, const void *value, size_t len)
+
+{
+    return nvs_set(key, value, len);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Traces, sorted by sweep and channel, trace_at[] has each one's first
+
+typedef struct _trace_rec_t
+
+{
+    int sweep, seq;
+    wifi_ap_record_t rec;
+
+} trace_rec_t;
+
+static trace_rec_t *trace = NULL;
+static int trace_len = 0, trace_alloc = 0, trace_sweeps = 0;
+static int *trace_at = NULL;
+static int trace_aps = 0;                   // Distinct BSSIDs
+
+#define TRACE_AT(sweep, chan)   trace_at[(sweep) * (AP_CHAN_MAX + 2) + (chan)]
+
+static int  trace_add(int sweep, const uint8_t *bssid, const char *ssid,
+                            int chan, int rssi, int auth)
+
+{
+    if(sweep < 0 || chan < 1 || chan > AP_CHAN_MAX || rssi > 0 || rssi < -127
+                                || auth < 0 || auth >= WIFI_AUTH_MAX)
+        return -1;
+    if(trace_len >= trace_alloc)
+        {
+        trace_alloc = trace_alloc ? trace_alloc * 2 : 1024;
+        trace = realloc(trace, trace_alloc * sizeof(trace_rec_t));
+        if(trace == NULL)
+            {
+            fprintf(stderr, "No memory for the trace\n");
+            exit(1);
+            }
+        }
+    trace_rec_t *tt = &trace[trace_len];
+    memset(tt, 0, sizeof(*tt));
+    tt->sweep = sweep; tt->seq = trace_len++;
+    memcpy(tt->rec.bssid, bssid, sizeof(tt->rec.bssid));
+    strncpy((char*)tt->rec.ssid, ssid, sizeof(tt->rec.ssid) - 1);
+    tt->rec.primary = chan;
+    tt->rec.rssi = rssi;
+    tt->rec.authmode = auth;
+    return 0;
+}
+
+static int  trace_cmp(const void *aa, const void *bb)
+
+{
+    const trace_rec_t *ta = aa, *tb = bb;
+
+    if(ta->sweep != tb->sweep)
+        return ta->sweep - tb->sweep;
+    if(ta->rec.primary != tb->rec.primary)
+        return ta->rec.primary - tb->rec.primary;
+    return ta->seq - tb->seq;
+}
+
+static int  bssid_cmp(const void *aa, const void *bb)
+
+{
+    return memcmp(aa, bb, 6);
+}
+
+// Sort, index and count the APs
+
+static void trace_index()
+
+{
+    qsort(trace, trace_len, sizeof(trace_rec_t), trace_cmp);
+    trace_sweeps = trace_len ? trace[trace_len - 1].sweep + 1 : 0;
+
+    free(trace_at);
+    trace_at = malloc((trace_sweeps * (AP_CHAN_MAX + 2) + 1) * sizeof(int));
+    uint8_t (*ids)[6] = malloc((trace_len + 1) * 6);
+    if(trace_at == NULL || ids == NULL)
+        {
+        fprintf(stderr, "No memory for the trace\n");
+        exit(1);
+        }
+    int pos = 0;
+    for(int loop = 0; loop < trace_sweeps; loop++)
+        {
+        for(int chan = 0; chan < AP_CHAN_MAX + 2; chan++)
+            {
+            while(pos < trace_len && trace[pos].sweep == loop &&
+                                        trace[pos].rec.primary < chan)
+                pos++;
+            TRACE_AT(loop, chan) = pos;
+            }
+        }
+    for(int loop = 0; loop < trace_len; loop++)
+        memcpy(ids[loop], trace[loop].rec.bssid, 6);
+    qsort(ids, trace_len, 6, bssid_cmp);
+    trace_aps = 0;
+    for(int loop = 0; loop < trace_len; loop++)
+        {
+        if(loop == 0 || memcmp(ids[loop], ids[loop - 1], 6))
+            trace_aps++;
+        }
+    free(ids);
+}
+
+static void trace_load(const char *fname)
+
+{
+    char line[256];
+    int lineno = 0, bad = 0;
+
+    FILE *fp = fopen(fname, "r");
+    if(fp == NULL)
+        {
+        fprintf(stderr, "Cannot open '%s'\n", fname);
+        exit(1);
+        }
+    while(fgets(line, sizeof(line), fp))
+        {
+        char *tail, *comma[3], *ssid;
+        uint8_t bssid[6];
+        int sweep, len;
+
+        lineno++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if(line[0] == '\0' || line[0] == '#' || strncmp(line, "sweep", 5) == 0)
+            continue;
+
+        // Sweep and BSSID from the front, the numbers from the back
+        if(sscanf(line, "%d,%hhx:%hhx:%hhx:%hhx:%hhx:%hhx,%n", &sweep,
+                    &bssid[0], &bssid[1], &bssid[2], &bssid[3], &bssid[4],
+                        &bssid[5], &len) != 7)
+            len = 0;
+        ssid = line + len;
+        for(int loop = 0; loop < 3 && len; loop++)
+            {
+            comma[loop] = strrchr(ssid, ',');
+            if(comma[loop] == NULL)
+                len = 0;
+            else
+                *comma[loop] = '\0';
+            }
+        if(len == 0 || trace_add(sweep, bssid, ssid, strtol(comma[2] + 1, &tail, 10),
+                    strtol(comma[1] + 1, &tail, 10), strtol(comma[0] + 1, &tail, 10)))
+            {
+            if(bad++ < 5)
+                fprintf(stderr, "%s:%d: bad record\n", fname, lineno);
+            }
+        }
+    fclose(fp);
+    if(bad)
+        fprintf(stderr, "%s: %d bad records skipped\n", fname, bad);
+    trace_index();
+}
+
+static void trace_dump()
+
+{
+    printf("sweep,bssid,ssid,channel,rssi,auth\n");
+    for(int loop = 0; loop < trace_len; loop++)
+        {
+        const wifi_ap_record_t *rr = &trace[loop].rec;
+        printf("%d,%02x:%02x:%02x:%02x:%02x:%02x,%s,%d,%d,%d\n", trace[loop].sweep,
+                    rr->bssid[0], rr->bssid[1], rr->bssid[2], rr->bssid[3],
+                        rr->bssid[4], rr->bssid[5], rr->ssid, rr->primary,
+                            rr->rssi, rr->authmode);
+        }
+}
+
+// Repeatable on any libc
+
+static uint32_t rnd_state = 1;
+
+static uint32_t rnd()
+
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+static int  rnd_range(int lo, int hi)
+
+{
+    return lo + (int)(rnd() % (uint32_t)(hi - lo + 1));
+}
+
+static void trace_synth(int aps, int sweeps, int churn)
+
+{
+    static const int busy[] = { 1, 6, 11 };
+    // Percent: open, WEP, WPA, WPA2, WPA/WPA2
+    static const int auths[] = { 15, 3, 7, 60, 15 };
+
+    int8_t *base = malloc(aps), *rssi = malloc(aps);
+    uint8_t *chan = malloc(aps), *auth = malloc(aps), *away = malloc(aps);
+    if(base == NULL || rssi == NULL || chan == NULL || auth == NULL || away == NULL)
+        {
+        fprintf(stderr, "No memory for the trace\n");
+        exit(1);
+        }
+    for(int loop = 0; loop < aps; loop++)
+        {
+        chan[loop] = rnd() % 100 < 60 ? busy[rnd() % 3] : rnd_range(1, 13);
+        base[loop] = rssi[loop] = rnd_range(-92, -35);
+        int pick = rnd() % 100;
+        for(auth[loop] = 0; pick >= auths[auth[loop]]; auth[loop]++)
+            pick -= auths[auth[loop]];
+        away[loop] = 0;
+        }
+    for(int loop = 0; loop < sweeps; loop++)
+        {
+        for(int loopc = 0; loopc < aps; loopc++)
+            {
+            char ssid[33] = "";
+            uint8_t bssid[6] = { 0x02, 0x00, 0x5e, loopc >> 16, loopc >> 8, loopc };
+
+            // Gone for a while, powered off or out of range
+            if(away[loopc])
+                {
+                away[loopc]--;
+                continue;
+                }
+            if(loop && (int)(rnd() % 1000) < churn * 10)
+                {
+                away[loopc] = rnd_range(1, 20);
+                continue;
+                }
+            int rr = rssi[loopc] + rnd_range(-3, 3);
+            rr = MIN(MAX(rr, base[loopc] - 10), base[loopc] + 10);
+            rssi[loopc] = rr = MIN(MAX(rr, -95), -20);
+
+            // Weak ones are missed often, strong ones now and then
+            if((int)(rnd() % 100) < (rr < -85 ? 50 : 5))
+                continue;
+
+            // One in twenty hidden
+            if(loopc % 20 != 19)
+                snprintf(ssid, sizeof(ssid), "net-%03d", loopc);
+            trace_add(loop, bssid, ssid, chan[loopc], rr, auth[loopc]);
+            }
+        }
+    free(base); free(rssi); free(chan); free(auth); free(away);
+    trace_index();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// The scan calls. One channel at a time, as wifi.c asks.
+
+static system_event_cb_t event_cb = NULL;
+static void *event_ctx = NULL;
+
+static pthread_mutex_t scan_lock = PTHREAD_MUTEX_INITIALIZER;
+static wifi_ap_record_t *found = NULL;      // The driver's list
+static int found_count = 0, found_alloc = 0;
+static int sim_sweep = -1, sim_chan = AP_CHAN_MAX + 1;
+static int64_t done_us[AP_CHAN_MAX + 1];    // SCAN_DONE real time, ...
+static int done_sweep[AP_CHAN_MAX + 1];     // ... of which sweep
+static int64_t heard = 0, cut = 0;          // Records, and not fetched
+static int found_max = 0;                   // Most on one channel
+
+static void scan_do(const wifi_scan_config_t *config)
+
+{
+    int chan = config->channel, dwell;
+
+    pthread_mutex_lock(&scan_lock);
+    if(chan <= sim_chan)
+        sim_sweep++;
+    sim_chan = chan;
+    int sweep = sim_sweep, ss = sweep % trace_sweeps;
+    int first = TRACE_AT(ss, chan), end = TRACE_AT(ss, chan + 1);
+    pthread_mutex_unlock(&scan_lock);
+
+    if(config->scan_type == WIFI_SCAN_TYPE_PASSIVE)
+        dwell = config->scan_time.passive ? config->scan_time.passive : SIM_PASSIVE_MS;
+    else
+        {
+        dwell = config->scan_time.active.max;
+        if(first == end && config->scan_time.active.min)
+            dwell = config->scan_time.active.min;
+        if(dwell == 0)
+            dwell = SIM_ACTIVE_MS;
+        }
+    sim_sleep((dwell + SIM_HOP_MS) * 1000LL);
+
+    pthread_mutex_lock(&scan_lock);
+    if(end - first > found_alloc)
+        {
+        found_alloc = end - first;
+        found = realloc(found, found_alloc * sizeof(wifi_ap_record_t));
+        }
+    cut += found_count;
+    found_count = 0;
+    for(int loop = first; loop < end; loop++)
+        {
+        if(trace[loop].rec.ssid[0] || config->show_hidden)
+            found[found_count++] = trace[loop].rec;
+        }
+    heard += found_count;
+    found_max = MAX(found_max, found_count);
+    done_us[chan] = real_us();
+    done_sweep[chan] = sweep;
+    pthread_mutex_unlock(&scan_lock);
+
+    system_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.event_id = SYSTEM_EVENT_SCAN_DONE;
+    event.event_info.scan_done.number = MIN(found_count, 255);
+    if(event_cb != NULL)
+        event_cb(event_ctx, &event);
+}
+
+static void scan_job(void *parm)
+
+{
+    scan_do((wifi_scan_config_t *)parm);
+    free(parm);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_event_loop_init(system_event_cb_t cb, void *ctx)
+
+{
+    event_cb = cb;
+    event_ctx = ctx;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block)
+
+{
+    if(config == NULL || config->channel < 1 || config->channel > AP_CHAN_MAX)
+        return ESP_ERR_INVALID_ARG;
+    if(trace_sweeps == 0)
+        return ESP_ERR_INVALID_STATE;
+    if(block)
+        {
+        scan_do(config);
+        return ESP_OK;
+        }
+    wifi_scan_config_t *job = malloc(sizeof(wifi_scan_config_t));
+    if(job == NULL)
+        return ESP_ERR_NO_MEM;
+    *job = *config;
+    xTaskCreate(scan_job, "scan_job", 2048, job, 5, NULL);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_stop(void)
+
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_num(uint16_t *number)
+
+{
+    pthread_mutex_lock(&scan_lock);
+    *number = found_count;
+    pthread_mutex_unlock(&scan_lock);
+    return ESP_OK;
+}
+
+// Up to number records, the rest are dropped with the list
+
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *recs)
+
+{
+    pthread_mutex_lock(&scan_lock);
+    int cnt = MIN(*number, found_count);
+    memcpy(recs, found, cnt * sizeof(wifi_ap_record_t));
+    cut += found_count - cnt;
+    found_count = 0;
+    *number = cnt;
+    pthread_mutex_unlock(&scan_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config) { return ESP_OK; }
+esp_err_t esp_wifi_deinit(void) { return ESP_OK; }
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode) { return ESP_OK; }
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type) { return ESP_OK; }
+esp_err_t esp_wifi_set_config(esp_interface_t iface, wifi_config_t *config) { return ESP_OK; }
+esp_err_t esp_wifi_start(void) { return ESP_OK; }
+esp_err_t esp_wifi_stop(void) { return ESP_OK; }
+esp_err_t esp_wifi_connect(void) { return ESP_OK; }
+esp_err_t esp_wifi_disconnect(void) { return ESP_OK; }
+esp_err_t esp_wifi_wps_enable(const esp_wps_config_t *config) { return ESP_OK; }
+esp_err_t esp_wifi_wps_disable(void) { return ESP_OK; }
+esp_err_t esp_wifi_wps_start(int timeout_ms) { return ESP_OK; }
+esp_err_t esp_smartconfig_stop(void) { return ESP_OK; }
+esp_err_t esp_esptouch_set_timeout(uint8_t time_s) { return ESP_OK; }
+
+const char *esp_smartconfig_get_version(void)
+
+{
+    return "wifisim";
+}
+
+esp_err_t esp_wifi_get_mac(esp_interface_t iface, uint8_t mac[6])
+
+{
+    static const uint8_t sim_mac[6] = { 0x02, 0x00, 0x5e, 0x00, 0x51, 0x4d };
+    memcpy(mac, sim_mac, sizeof(sim_mac));
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *info)
+
+{
+    return ESP_FAIL;
+}
+
+// utils.c needs lwip and SNTP, wifi.c only logs with this
+
+int printauth(int auth)
+
+{
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Heap, screen memory, SPI
+
+static uint16_t screen_top[SCREEN_HEIGHT / 2][SCREEN_WIDTH];
+static uint16_t screen_bottom[SCREEN_HEIGHT / 2][SCREEN_WIDTH];
+
+uint16_t (*pscreen)[SCREEN_HEIGHT / 2][SCREEN_WIDTH] = &screen_top;
+uint16_t (*pscreen2)[SCREEN_HEIGHT / 2][SCREEN_WIDTH] = &screen_bottom;
+
+static int64_t sent_px = 0;
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+
+{
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+
+{
+    free(ptr);
+}
+
+char *itoa(int value, char *str, int base)
+
+{
+    sprintf(str, base == 16 ? "%x" : "%d", value);
+    return str;
+}
+
+// Counted, the wire time is for tft_bench on the device
+
+int  tft_flush_rect(spi_device_handle_t spi, int xx, int yy, int ww, int hh)
+
+{
+    sent_px += ww * hh;
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Latency samples
+
+typedef struct _sim_stat_t
+
+{
+    int64_t *us;
+    int count, alloc;
+
+} sim_stat_t;
+
+static void stat_add(sim_stat_t *st, int64_t us)
+
+{
+    if(st->count >= st->alloc)
+        {
+        st->alloc = st->alloc ? st->alloc * 2 : 256;
+        st->us = realloc(st->us, st->alloc * sizeof(int64_t));
+        }
+    st->us[st->count++] = us;
+}
+
+static int  us_cmp(const void *aa, const void *bb)
+
+{
+    int64_t da = *(const int64_t *)aa, db = *(const int64_t *)bb;
+    return da < db ? -1 : da > db;
+}
+
+// Sorts the samples
+
+static int64_t stat_pct(sim_stat_t *st, int pct)
+
+{
+    if(st->count == 0)
+        return 0;
+    qsort(st->us, st->count, sizeof(int64_t), us_cmp);
+    return st->us[MIN(st->count * pct / 100, st->count - 1)];
+}
+
+static int64_t stat_avg(const sim_stat_t *st)
+
+{
+    int64_t sum = 0;
+
+    for(int loop = 0; loop < st->count; loop++)
+        sum += st->us[loop];
+    return st->count ? sum / st->count : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Render task, the AP rows of tft_sniff.c in screen memory
+
+enum { STAGE_TABLE, STAGE_VIEW, STAGE_ROWS, STAGE_TOTAL, STAGES };
+
+static const char *stage_names[STAGES] = { "table", "view", "rows", "total" };
+
+static tft_label_t ssid_labels[AP_ROWS], auth_labels[AP_ROWS];
+static tft_num_t chan_nums[AP_ROWS], rssi_nums[AP_ROWS];
+static ap_view_t ap_view;
+static wifi_snap_t *snap, *spare;
+
+static sim_stat_t stats[STAGES];
+static int  run_sweeps = 10, poll_ms = 0, bench = false;
+static int  drawn = 0, skipped = 0, lapped = 0;
+static SemaphoreHandle_t finished;
+
+static const char *auth_name(int mode)
+
+{
+    switch(mode)
+        {
+        case WIFI_AUTH_OPEN:    return "OPEN";
+        case WIFI_AUTH_WEP:     return "WEP ";
+        case WIFI_AUTH_WPA_PSK: return "WPA ";
+        case WIFI_AUTH_WPA2_PSK:
+        case WIFI_AUTH_WPA_WPA2_PSK:
+        case WIFI_AUTH_WPA2_ENTERPRISE:
+                                return "WPA2";
+        }
+    return "UKN";
+}
+
+static void rows_init()
+
+{
+    const tft_font_t *font16 = tft_font_get(TFT_FONT_16);
+
+    tft_gcache_init(CONFIG_TFT_GLYPH_CACHE_SIZE);
+    for(int loopc = 0; loopc < AP_ROWS; loopc++)
+        {
+        int top = 34 + 18 * loopc;
+        tft_label_init(&ssid_labels[loopc], font16, 4, top, 201,
+                    TFT_ALIGN_LEFT | TFT_LAYOUT_ELLIPSIS, TFT_WHITE, fontback);
+        tft_num_init(&chan_nums[loopc], font16, 205, top, 2, "ch", NULL,
+                                                        TFT_WHITE, fontback);
+        tft_num_init(&rssi_nums[loopc], font16, 237, top, 3, NULL, "dB",
+                                                        TFT_WHITE, fontback);
+        tft_label_init(&auth_labels[loopc], font16, 280, top, SCREEN_WIDTH - 282,
+                    TFT_ALIGN_LEFT, TFT_WHITE, fontback);
+        }
+}
+
+static void render_rows()
+
+{
+    static const ap_filter_t all = { 0, -1, NULL };
+    const ap_entry_t *ee = NULL;
+    char tmp[48];
+    int pos = 0;
+
+    for(int loopc = 0; loopc < AP_ROWS; loopc++)
+        {
+        tmp[0] = '\0';
+        if(loopc == 0 || ee != NULL)
+            ee = ap_view_next(&ap_view, AP_SORT_RSSI, &all, &pos);
+        if(ee != NULL)
+            {
+            snprintf(tmp, sizeof(tmp), "%02d %s",  loopc + 1, (char*)ee->ssid);
+            tft_num_set(NULL, &chan_nums[loopc], ee->primary);
+            tft_num_set(NULL, &rssi_nums[loopc], ee->rssi_shown);
+            tft_label_set(NULL, &auth_labels[loopc], (uint8_t*)auth_name(ee->authmode));
+            }
+        else
+            {
+            tft_num_clear(NULL, &chan_nums[loopc]);
+            tft_num_clear(NULL, &rssi_nums[loopc]);
+            tft_label_set(NULL, &auth_labels[loopc], (uint8_t*)"");
+            }
+        tft_label_set(NULL, &ssid_labels[loopc], (uint8_t*)tmp);
+        }
+}
+
+static void render_task(void *parm)
+
+{
+    uint32_t have = 0;
+
+    while(true)
+        {
+        if(poll_ms)
+            vTaskDelay(MAX(poll_ms / portTICK_PERIOD_MS, 1));
+        else
+            xEventGroupWaitBits(wifi_event_group, SLICED_BIT, true, false, portMAX_DELAY);
+
+        if(wcwifi_snap_gen() == have)
+            continue;
+        if(!wcwifi_snap_read(&snap, &spare))
+            {
+            lapped++;
+            continue;
+            }
+        int64_t got = real_us();
+        if(have)
+            skipped += snap->gen - have - 1;
+        have = snap->gen;
+        drawn++;
+
+        // The scan this snapshot ends with, unless the driver moved on
+        int sweep = snap->done ? snap->sweeps - 1 : snap->sweeps, chan = snap->chan;
+        int64_t done = 0;
+        pthread_mutex_lock(&scan_lock);
+        if(chan >= 1 && chan <= AP_CHAN_MAX && done_sweep[chan] == sweep)
+            done = done_us[chan];
+        pthread_mutex_unlock(&scan_lock);
+
+        ap_view_update(&ap_view, snap);
+        int64_t sorted = real_us();
+        render_rows();
+        int64_t rendered = real_us();
+
+        if(done)
+            {
+            stat_add(&stats[STAGE_TABLE], got - done);
+            stat_add(&stats[STAGE_TOTAL], rendered - done);
+            }
+        stat_add(&stats[STAGE_VIEW], sorted - got);
+        stat_add(&stats[STAGE_ROWS], rendered - sorted);
+
+        if(!snap->done)
+            continue;
+        if(!bench)
+            printf("sweep %3d  table %3d  shown %3d  idle %5d ms  saved %3d  "
+                    "duty %3d%%  view %4lld us  rows %4lld us\n",
+                        snap->sweeps, snap->total, snap->count, snap->idle_ms,
+                            snap->saved, snap->duty, (long long)(sorted - got),
+                                (long long)(rendered - sorted));
+        if((int)snap->sweeps >= run_sweeps)
+            {
+            xSemaphoreGive(finished);
+            vTaskDelete(NULL);
+            }
+        }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static void run(const char *prof)
+
+{
+    real_start = real_us();
+    snap = malloc(sizeof(wifi_snap_t));
+    spare = malloc(sizeof(wifi_snap_t));
+    finished = xSemaphoreCreateBinary();
+    if(snap == NULL || spare == NULL || finished == NULL)
+        {
+        fprintf(stderr, "No memory for the snapshot\n");
+        exit(1);
+        }
+    rows_init();
+    ap_view_init(&ap_view);
+
+    wifi_preinit();
+    if(prof != NULL && scan_prof_select(scan_prof_find(prof)) < 0)
+        {
+        fprintf(stderr, "No scan profile '%s'\n", prof);
+        exit(1);
+        }
+    xTaskCreate(render_task, "render_task", 4096, NULL, 2, NULL);
+    while(wcwifi_scan_start() != 0)
+        vTaskDelay(500 / portTICK_PERIOD_MS);
+
+    xSemaphoreTake(finished, portMAX_DELAY);
+    wcwifi_scan_stop();
+}
+
+static void report()
+
+{
+    int64_t sweeps = sim_sweep + 1;
+
+    printf("\n%d APs in %d sweeps of trace, %d sweeps run, %lld s simulated\n",
+                trace_aps, trace_sweeps, (int)sweeps,
+                        (long long)(esp_timer_get_time() / 1000000));
+    printf("Heard %lld per sweep, %lld not fetched, up to %d on a channel\n",
+                (long long)(heard / sweeps), (long long)(cut / sweeps), found_max);
+    printf("Table %d (max %d), shown %d\n", snap->total, AP_TABLE_MAX, snap->count);
+    printf("Snapshots drawn %d, skipped %d, lapped %d, %lld pixels each\n",
+                drawn, skipped, lapped, (long long)(drawn ? sent_px / drawn : 0));
+    printf("\nStage        min      avg      p95      max   (us)\n");
+    for(int loop = 0; loop < STAGES; loop++)
+        {
+        sim_stat_t *st = &stats[loop];
+        int64_t avg = stat_avg(st), p95 = stat_pct(st, 95);
+        printf("%-8s %8lld %8lld %8lld %8lld\n", stage_names[loop],
+                    (long long)stat_pct(st, 0), (long long)avg, (long long)p95,
+                        (long long)stat_pct(st, 100));
+        }
+    printf("\n");
+    scan_prof_report();
+}
+
+// One line per size, each run in a fresh process
+
+static void bench_run(const char *prof, int churn)
+
+{
+    static const int sizes[] = { 10, 100, 500 };
+
+    printf("  APs  heard  lost  table shown  drawn skip");
+    for(int loop = 0; loop < STAGES; loop++)
+        printf("  %-13s", stage_names[loop]);
+    printf("  (avg/p95 us)\n");
+    fflush(stdout);
+    for(int loop = 0; loop < (int)(sizeof(sizes) / sizeof(sizes[0])); loop++)
+        {
+        pid_t pid = fork();
+        if(pid < 0)
+            {
+            fprintf(stderr, "Cannot fork\n");
+            exit(1);
+            }
+        if(pid > 0)
+            {
+            waitpid(pid, NULL, 0);
+            continue;
+            }
+        trace_synth(sizes[loop], run_sweeps, churn);
+        run(prof);
+
+        int64_t sweeps = sim_sweep + 1;
+        printf("%5d %6lld %5lld %6d %5d %6d %4d", trace_aps, (long long)(heard / sweeps),
+                    (long long)(cut / sweeps), snap->total, snap->count, drawn, skipped);
+        for(int loopc = 0; loopc < STAGES; loopc++)
+            {
+            sim_stat_t *st = &stats[loopc];
+            int64_t avg = stat_avg(st);
+            printf("  %6lld/%-6lld", (long long)avg, (long long)stat_pct(st, 95));
+            }
+        printf("\n");
+        fflush(stdout);
+        _exit(0);
+        }
+}
+
+// ap_chan's power table: each whole dB in has to come back as itself,
+// and removing the AP again has to leave nothing. Returns failures.
+
+static int  chan_check()
+
+{
+    static ap_chan_t chan;
+    int bad = 0;
+
+    ap_chan_init(&chan);
+    for(int rssi = AP_CHAN_FLOOR; rssi <= AP_CHAN_CEIL; rssi++)
+        {
+        ap_chan_add(&chan, 6, rssi, 1);
+        int dbm = ap_chan_dbm(chan.ch[6].power);
+        ap_chan_add(&chan, 6, rssi, -1);
+        if(dbm != rssi || chan.ch[6].power != 0 || chan.ch[2].overlap != 0)
+            {
+            printf("ap_chan: %d dBm comes back as %d\n", rssi, dbm);
+            bad++;
+            }
+        }
+    printf("ap_chan: %d of %d dB steps off\n", bad,
+                                    AP_CHAN_CEIL - AP_CHAN_FLOOR + 1);
+    return bad;
+}
+
+static void usage()
+
+{
+    fprintf(stderr,
+        "Usage: wifisim -trace file.csv | -synth aps [-seed n] [-churn pct]\n"
+        "               [-sweeps n] [-prof name] [-speed x] [-poll ms] [-v]\n"
+        "       wifisim -synth aps [-seed n] [-churn pct] [-sweeps n] -dump\n"
+        "       wifisim -bench [-sweeps n] [-prof name] [-speed x] [-poll ms]\n"
+        "       wifisim -check\n");
+    exit(1);
+}
+
+int     main(int argc, char *argv[])
+
+{
+    const char *fname = NULL, *prof = NULL;
+    int synth = 0, churn = 2, dump = false;
+
+    for(int loop = 1; loop < argc; loop++)
+        {
+        const char *opt = argv[loop], *arg = argv[loop + 1];
+        if(strcmp(opt, "-bench") == 0)
+            { bench = true; continue; }
+        if(strcmp(opt, "-dump") == 0)
+            { dump = true; continue; }
+        if(strcmp(opt, "-v") == 0)
+            { verbose = true; continue; }
+        if(strcmp(opt, "-check") == 0)
+            return chan_check() ? 1 : 0;
+        if(loop == argc - 1)
+            usage();
+        loop++;
+        if(strcmp(opt, "-trace") == 0)
+            fname = arg;
+        else if(strcmp(opt, "-synth") == 0)
+            synth = atoi(arg);
+        else if(strcmp(opt, "-seed") == 0)
+            rnd_state = strtoul(arg, NULL, 0) | 1;
+        else if(strcmp(opt, "-churn") == 0)
+            churn = atoi(arg);
+        else if(strcmp(opt, "-sweeps") == 0)
+            run_sweeps = atoi(arg);
+        else if(strcmp(opt, "-prof") == 0)
+            prof = arg;
+        else if(strcmp(opt, "-speed") == 0)
+            speed = atof(arg);
+        else if(strcmp(opt, "-poll") == 0)
+            poll_ms = atoi(arg);
+        else
+            usage();
+        }
+    if(run_sweeps < 1 || speed <= 0 || churn < 0 || churn > 100 || poll_ms < 0)
+        usage();
+    if(bench)
+        {
+        // Quiet sites stretch the idle time, make it short
+        if(speed == 1)
+            speed = 50;
+        bench_run(prof, churn);
+        return 0;
+        }
+    if((fname != NULL) + (synth > 0) != 1)
+        usage();
+    if(fname != NULL)
+        trace_load(fname);
+    else
+        trace_synth(synth, run_sweeps, churn);
+    if(dump)
+        {
+        trace_dump();
+        return 0;
+        }
+    if(trace_len == 0)
+        {
+        fprintf(stderr, "Empty trace\n");
+        return 1;
+        }
+    run(prof);
+    report();
+    return 0;
+}
+
+// EOF